@@ -38,6 +38,8 @@
 /* Includes ------------------------------------------------------------------*/
 #include "fonts.h"
 
+#if !FONT_SUBSET
+
 // 
 //  Font data for Courier New 12pt
 // 
@@ -1381,4 +1383,6 @@ sFONT Font12 = {
   12, /* Height */
 };
 
+#endif /* !FONT_SUBSET */
+
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
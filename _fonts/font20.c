@@ -38,6 +38,8 @@
 /* Includes ------------------------------------------------------------------*/
 #include "fonts.h"
 
+#if !FONT_SUBSET
+
 // Character bitmaps for Courier New 15pt
 const uint8_t Font20_Table[] = 
 {
@@ -2139,4 +2141,6 @@ sFONT Font20 = {
   20, /* Height */
 };
 
+#endif /* !FONT_SUBSET */
+
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -38,6 +38,8 @@
 /* Includes ------------------------------------------------------------------*/
 #include "fonts.h"
 
+#if !FONT_SUBSET
+
 const uint8_t Font24_Table [] = 
 {
 	// @0 ' ' (17 pixels wide)
@@ -2517,4 +2519,6 @@ sFONT Font24 = {
   24, /* Height */
 };
 
+#endif /* !FONT_SUBSET */
+
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -3,6 +3,8 @@
 
 #include "fonts.h"
 
+#if !FONT_SUBSET
+
 const uint8_t Font32_Table[] = 
 {
 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // <space>
@@ -111,4 +113,6 @@ sFONT Font32 = {
   Font32_Table,
   16,
   32,
-};
\ No newline at end of file
+};
+
+#endif /* !FONT_SUBSET */
@@ -2,6 +2,8 @@
 
 #include "fonts.h"
 
+#if !FONT_SUBSET
+
 
 
 const uint8_t Font48_Table[] = 
@@ -113,4 +115,6 @@ sFONT Font48 = {
   Font48_Table,
   24,
   48,
-};
\ No newline at end of file
+};
+
+#endif /* !FONT_SUBSET */
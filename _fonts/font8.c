@@ -38,6 +38,8 @@
 /* Includes ------------------------------------------------------------------*/
 #include "fonts.h"
 
+#if !FONT_SUBSET
+
 // 
 //  Font data for Courier New 12pt
 // 
@@ -1001,4 +1003,6 @@ sFONT Font8 = {
   8, /* Height */
 };
 
+#endif /* !FONT_SUBSET */
+
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
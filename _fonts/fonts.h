@@ -36,8 +36,8 @@
   */
 
 /* Define to prevent recursive inclusion -------------------------------------*/
-#ifndef __FONTS_H
-#define __FONTS_H
+#ifndef __SFONTS_H
+#define __SFONTS_H
 
 /* Max size of bitmap will based on a font24 (17x24) */
 #define MAX_HEIGHT_FONT         24
@@ -51,11 +51,17 @@
 /* Includes ------------------------------------------------------------------*/
 #include <stdint.h>
 
+/* 1: only the glyphs listed in fonts-subset.c are linked (sim/fontsubset) */
+#ifndef FONT_SUBSET
+#define FONT_SUBSET 0
+#endif
+
 typedef struct _tFont
 {    
   const uint8_t *table;
   uint16_t Width;
   uint16_t Height;
+  const uint8_t *Map;    /* ' '..'~' -> glyph index in table; NULL = full table */
   
 } sFONT;
 
@@ -71,7 +77,7 @@ extern sFONT Font8;
 }
 #endif
   
-#endif /* __FONTS_H */
+#endif /* __SFONTS_H */
  
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
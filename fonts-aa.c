@@ -0,0 +1,395 @@
+/// fonts-aa.c - Fonte anti-aliased 12x24, 2 bits por pixel (formato em fonts.h)
+///
+/// Gerado por sim/fontaa (make -C sim aa) a partir da Font48 em
+/// _fonts/font48.c. Não editar à mão.
+#include <stdint.h>
+#include "fonts.h"
+
+#if !FONT_SUBSET
+
+static const uint8_t fontAA24Table[6840] = {
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // ' '
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,
+    0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,
+    0x00,0x3D,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x00,
+    0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '!'
+    0x00,0x00,0x00,0x02,0x90,0x64,0x03,0xE0,0xF8,0x0B,0xC2,0xF4,0x0F,0xC2,0xF0,0x1F,0x87,0xF0,
+    0x2F,0x8B,0xE0,0x2F,0x8B,0xF0,0x2F,0x8B,0xF0,0x1A,0x46,0xA0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '"'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x28,0x00,0xB8,0xBC,0x00,0xB8,0xB8,0x00,0xF8,0xB8,
+    0x00,0xF4,0xF4,0x3F,0xFF,0xFF,0x3F,0xFF,0xFF,0x3F,0xFF,0xFF,0x03,0xE2,0xE0,0x03,0xD3,0xE0,
+    0x07,0xC3,0xD0,0xAB,0xEB,0xE8,0xFF,0xFF,0xFC,0xFF,0xFF,0xFC,0xAF,0xAF,0xA8,0x1F,0x0F,0x40,
+    0x2F,0x1F,0x00,0x2E,0x2F,0x00,0x3E,0x2E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '#'
+    0x00,0x28,0x00,0x00,0x2C,0x00,0x00,0x2C,0x00,0x01,0xBE,0x90,0x07,0xFF,0xF0,0x0F,0xFF,0xF0,
+    0x1F,0xAD,0xB0,0x2F,0xAC,0x00,0x2F,0xAC,0x00,0x1F,0xEC,0x00,0x0B,0xFF,0x80,0x07,0xFF,0xE0,
+    0x01,0xBF,0xF4,0x00,0x2E,0xF8,0x00,0x2C,0xFC,0x14,0x2C,0xFC,0x2E,0x6D,0xF8,0x2F,0xFF,0xF4,
+    0x1F,0xFF,0xE0,0x06,0xFF,0x80,0x00,0x2C,0x00,0x00,0x2C,0x00,0x00,0x2C,0x00,0x00,0x28,0x00,  // '$'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xD0,0x00,0x7F,0xF0,0x00,0xBA,0xB8,0x00,
+    0xF0,0xB8,0x00,0xB4,0xB8,0x00,0xBE,0xF4,0x04,0x3F,0xE0,0x6E,0x1B,0x86,0xE4,0x00,0x2E,0x40,
+    0x02,0xF8,0x00,0x2F,0x82,0xF4,0x38,0x0B,0xFD,0x00,0x0F,0xAE,0x00,0x2E,0x0F,0x00,0x2E,0x0F,
+    0x00,0x0F,0xAE,0x00,0x0B,0xFD,0x00,0x02,0xF4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '%'
+    0x00,0x00,0x00,0x00,0x29,0x00,0x01,0xFF,0xC0,0x07,0xFF,0xC0,0x0B,0xFB,0xC0,0x0F,0xC0,0x40,
+    0x0F,0xC0,0x00,0x0B,0xD0,0x00,0x07,0xE0,0x00,0x07,0xF4,0x00,0x0F,0xF8,0x00,0x2F,0xFD,0x1A,
+    0x3E,0xBE,0x2F,0xBD,0x2F,0x6F,0xBC,0x1F,0xAE,0xBC,0x0B,0xFE,0xBE,0x07,0xFD,0xBF,0x03,0xF8,
+    0x3F,0xEF,0xF8,0x2F,0xFF,0xFD,0x0B,0xFE,0xBE,0x00,0xA4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '&'
+    0x00,0x00,0x00,0x00,0x0A,0x40,0x00,0x1F,0x00,0x00,0x2F,0x00,0x00,0x3E,0x00,0x00,0xBE,0x00,
+    0x00,0xFE,0x00,0x00,0xFE,0x00,0x00,0xFE,0x00,0x00,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '''
+    0x00,0x06,0x80,0x00,0x0B,0x80,0x00,0x1F,0x80,0x00,0x2F,0x00,0x00,0x3E,0x00,0x00,0x7E,0x00,
+    0x00,0xBD,0x00,0x00,0xBC,0x00,0x00,0xFC,0x00,0x00,0xFC,0x00,0x00,0xF8,0x00,0x00,0xF8,0x00,
+    0x00,0xF8,0x00,0x00,0xF8,0x00,0x00,0xFC,0x00,0x00,0xFC,0x00,0x00,0xBC,0x00,0x00,0xBD,0x00,
+    0x00,0x7E,0x00,0x00,0x3E,0x00,0x00,0x2F,0x00,0x00,0x0F,0x80,0x00,0x0B,0x80,0x00,0x06,0x80,  // '('
+    0x02,0x90,0x00,0x02,0xF0,0x00,0x00,0xF8,0x00,0x00,0xB8,0x00,0x00,0xBD,0x00,0x00,0x7E,0x00,
+    0x00,0x3E,0x00,0x00,0x3F,0x00,0x00,0x2F,0x00,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,
+    0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x00,0x00,0x3F,0x00,0x00,0x3E,0x00,
+    0x00,0x7E,0x00,0x00,0xBD,0x00,0x00,0xB8,0x00,0x00,0xF8,0x00,0x02,0xF0,0x00,0x02,0x90,0x00,  // ')'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x00,0x00,0x3C,0x00,
+    0x00,0x3C,0x00,0x34,0x3C,0x1C,0xBD,0x3C,0x7E,0x2F,0xBE,0xF8,0x07,0xFF,0xE0,0x00,0xBF,0x40,
+    0x02,0xFF,0x80,0x1B,0xFF,0xF4,0x7E,0x7D,0xBD,0x78,0x3C,0x2D,0x20,0x3C,0x08,0x00,0x3C,0x00,
+    0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '*'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0x3E,0x00,
+    0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0xBF,0xFF,0xFE,0xBF,0xFF,0xFE,
+    0xBF,0xFF,0xFE,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,
+    0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '+'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0x00,0x00,0xBF,0x00,0x00,0xBF,0x00,
+    0x00,0xBF,0x00,0x00,0xBE,0x00,0x00,0xFC,0x00,0x00,0xF8,0x00,0x01,0xF4,0x00,0x00,0x90,0x00,  // ','
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2A,0xAA,0xA9,0x3F,0xFF,0xFE,
+    0x3F,0xFF,0xFE,0x3F,0xFF,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '-'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6A,0x00,0x00,0xBF,0x00,
+    0x00,0xBF,0x00,0x00,0xBF,0x00,0x00,0xBF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '.'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0xB8,0x00,0x00,0xF0,
+    0x00,0x02,0xE0,0x00,0x03,0xD0,0x00,0x0B,0x80,0x00,0x0B,0x80,0x00,0x1F,0x00,0x00,0x2E,0x00,
+    0x00,0x3D,0x00,0x00,0xB8,0x00,0x00,0xF4,0x00,0x02,0xE0,0x00,0x02,0xE0,0x00,0x07,0xC0,0x00,
+    0x0B,0x80,0x00,0x0F,0x40,0x00,0x2E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '/'
+    0x00,0x00,0x00,0x00,0x28,0x00,0x01,0xFF,0x80,0x07,0xFF,0xD0,0x0B,0xFF,0xF0,0x0F,0xD3,0xF4,
+    0x1F,0x82,0xF8,0x2F,0x83,0xF8,0x2F,0x8B,0xFC,0x2F,0x8F,0xFC,0x2F,0x9D,0xFC,0x2F,0xA8,0xFC,
+    0x2F,0x74,0xFC,0x2F,0xF0,0xFC,0x2F,0xE0,0xFC,0x2F,0xC2,0xF8,0x2F,0x82,0xF8,0x0F,0xC3,0xF4,
+    0x0B,0xFF,0xF0,0x07,0xFF,0xE0,0x01,0xFF,0x80,0x00,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '0'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xBF,0x00,0x0F,0xFF,0x00,0x0F,0xFF,0x00,0x0F,0xBF,0x00,
+    0x08,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,
+    0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x0A,0xBF,0xA8,
+    0x0F,0xFF,0xFE,0x0F,0xFF,0xFE,0x0F,0xFF,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '1'
+    0x00,0x00,0x00,0x00,0x64,0x00,0x1B,0xFF,0x80,0x2F,0xFF,0xE0,0x2F,0xEF,0xF0,0x28,0x03,0xF8,
+    0x00,0x02,0xF8,0x00,0x02,0xF8,0x00,0x02,0xF8,0x00,0x03,0xF0,0x00,0x0B,0xE0,0x00,0x1F,0xC0,
+    0x00,0x3F,0x40,0x00,0xBE,0x00,0x01,0xF8,0x00,0x07,0xF4,0x00,0x0B,0xD0,0x00,0x2F,0xAA,0xA4,
+    0x3F,0xFF,0xF8,0x3F,0xFF,0xF8,0x3F,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '2'
+    0x00,0x00,0x00,0x00,0x68,0x00,0x0B,0xFF,0x80,0x2F,0xFF,0xE0,0x2F,0xFF,0xF0,0x19,0x06,0xF8,
+    0x00,0x02,0xF8,0x00,0x02,0xF8,0x00,0x02,0xF4,0x00,0xFF,0xE0,0x00,0xFF,0x80,0x00,0xFF,0xD0,
+    0x00,0xAB,0xF0,0x00,0x02,0xF8,0x00,0x00,0xFC,0x00,0x00,0xFC,0x00,0x00,0xFC,0x28,0x02,0xF8,
+    0x2F,0xFF,0xF8,0x2F,0xFF,0xE0,0x1F,0xFF,0x80,0x01,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '3'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0xE0,0x00,0x0F,0xF0,0x00,0x2F,0xF0,0x00,0x3F,0xF0,
+    0x00,0xBF,0xF0,0x00,0xF7,0xF0,0x02,0xF3,0xF0,0x03,0xE3,0xF0,0x0B,0xC3,0xF0,0x0F,0x83,0xF0,
+    0x2F,0x03,0xF0,0x3E,0xAB,0xE8,0x3F,0xFF,0xFE,0x3F,0xFF,0xFE,0x3F,0xFF,0xFD,0x00,0x03,0xE0,
+    0x00,0x03,0xF0,0x00,0x03,0xF0,0x00,0x03,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '4'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFF,0xF0,0x0F,0xFF,0xF0,0x0F,0xFF,0xF0,0x0F,0xAA,0xA0,
+    0x0F,0x80,0x00,0x0F,0x80,0x00,0x0F,0xA9,0x00,0x0F,0xFF,0x80,0x0F,0xFF,0xE0,0x0F,0xAF,0xF4,
+    0x08,0x02,0xF8,0x00,0x01,0xFC,0x00,0x00,0xFC,0x00,0x00,0xFC,0x00,0x01,0xFC,0x18,0x06,0xF8,
+    0x2F,0xFF,0xF4,0x2F,0xFF,0xE0,0x1F,0xFF,0x80,0x01,0xA8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '5'
+    0x00,0x00,0x00,0x00,0x06,0x00,0x00,0xBF,0xE0,0x02,0xFF,0xF0,0x07,0xFF,0xF0,0x0B,0xE0,0x20,
+    0x0F,0xC0,0x00,0x2F,0x80,0x00,0x2F,0x9A,0x40,0x2F,0x7F,0xE0,0x2F,0xFF,0xF4,0x2F,0xFB,0xF8,
+    0x2F,0xC1,0xFC,0x2F,0x80,0xFC,0x2F,0x80,0xBC,0x2F,0x80,0xBC,0x1F,0x80,0xFC,0x0F,0xC1,0xFC,
+    0x0B,0xFB,0xF8,0x07,0xFF,0xF0,0x01,0xFF,0xD0,0x00,0x2A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '6'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x2F,0xFF,0xF8,0x2F,0xFF,0xF8,0x2F,0xFF,0xF8,0x1A,0xAA,0xF8,
+    0x00,0x03,0xF0,0x00,0x07,0xF0,0x00,0x0B,0xE0,0x00,0x0B,0xD0,0x00,0x0F,0xC0,0x00,0x2F,0x80,
+    0x00,0x2F,0x80,0x00,0x3F,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xFC,0x00,0x01,0xF8,0x00,
+    0x02,0xF8,0x00,0x03,0xF4,0x00,0x03,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '7'
+    0x00,0x00,0x00,0x00,0x28,0x00,0x02,0xFF,0x80,0x0B,0xFF,0xE0,0x0F,0xFF,0xF0,0x1F,0x82,0xF8,
+    0x2F,0x80,0xF8,0x2F,0x80,0xF8,0x0F,0x82,0xF4,0x0B,0xEB,0xF0,0x02,0xFF,0x90,0x06,0xFF,0xD0,
+    0x0B,0xEB,0xF0,0x2F,0x81,0xF8,0x2F,0x00,0xFC,0x2F,0x00,0xFC,0x2F,0x00,0xFC,0x2F,0x81,0xF8,
+    0x1F,0xEB,0xF8,0x0B,0xFF,0xF0,0x02,0xFF,0xD0,0x00,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '8'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0x40,0x0B,0xFF,0xD0,0x0F,0xFF,0xF0,0x2F,0x82,0xF4,
+    0x2F,0x02,0xF8,0x2F,0x01,0xF8,0x3F,0x01,0xFC,0x2F,0x02,0xFC,0x2F,0x82,0xFC,0x2F,0xEB,0xFC,
+    0x0F,0xFF,0xFC,0x07,0xFE,0xFC,0x01,0xB8,0xFC,0x00,0x00,0xF8,0x00,0x02,0xF8,0x08,0x03,0xF4,
+    0x0F,0xAF,0xE0,0x0F,0xFF,0xD0,0x0F,0xFF,0x40,0x02,0xA8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '9'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x7E,0x00,0x00,0xBF,0x00,0x00,0xBF,0x00,0x00,0xBF,0x00,0x00,0xBF,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0x00,0x00,0xBF,0x00,0x00,0xBF,0x00,
+    0x00,0xBF,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // ':'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x7E,0x00,0x00,0xBF,0x00,0x00,0xBF,0x00,0x00,0xBF,0x00,0x00,0xBF,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0x00,0x00,0xBF,0x00,0x00,0xBF,0x00,
+    0x00,0xBF,0x00,0x00,0xBE,0x00,0x00,0xBC,0x00,0x00,0xF8,0x00,0x00,0xF4,0x00,0x00,0xA0,0x00,  // ';'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1A,
+    0x00,0x01,0xBE,0x00,0x1B,0xFE,0x01,0xBF,0xF8,0x1B,0xFE,0x80,0x3F,0xE4,0x00,0x3F,0x40,0x00,
+    0x3F,0xE4,0x00,0x1B,0xFE,0x40,0x01,0xFF,0xE4,0x00,0x2F,0xFE,0x00,0x02,0xFE,0x00,0x00,0x2E,
+    0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '<'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x3F,0xFF,0xFE,0x3F,0xFF,0xFE,0x3F,0xFF,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x3F,0xFF,0xFE,0x3F,0xFF,0xFE,0x3F,0xFF,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '='
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,
+    0x3F,0x80,0x00,0x3F,0xF8,0x00,0x1B,0xFF,0x80,0x01,0xBF,0xF8,0x00,0x0B,0xFE,0x00,0x00,0xBE,
+    0x00,0x0B,0xFE,0x00,0xBF,0xF8,0x0B,0xFF,0x80,0x3F,0xF8,0x00,0x3F,0x80,0x00,0x39,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '>'
+    0x00,0x00,0x00,0x00,0x19,0x00,0x02,0xFF,0xD0,0x0B,0xFF,0xF0,0x0B,0xFF,0xF8,0x0A,0x42,0xF8,
+    0x04,0x00,0xF8,0x00,0x02,0xF8,0x00,0x03,0xF0,0x00,0x0B,0xD0,0x00,0x2F,0x80,0x00,0x3F,0x00,
+    0x00,0xBE,0x00,0x00,0xBC,0x00,0x00,0xBC,0x00,0x00,0xBC,0x00,0x00,0x00,0x00,0x00,0x68,0x00,
+    0x00,0xBC,0x00,0x00,0xBC,0x00,0x00,0xBC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '?'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0x80,0x07,0xFF,0xE0,0x0B,0xEA,0xF8,0x2F,0x40,0xBC,
+    0x3E,0x00,0x3C,0xBC,0x0A,0x6D,0xB8,0x7F,0xFE,0xF4,0xBF,0xFE,0xF0,0xF4,0x7E,0xF2,0xF0,0x2E,
+    0xF2,0xF0,0x2E,0xF2,0xF0,0x2E,0xF1,0xF0,0x3E,0xF0,0xF8,0xBE,0xF8,0xBF,0xFE,0xB8,0x2F,0xED,
+    0x7C,0x06,0x00,0x2E,0x00,0x00,0x1F,0x80,0x14,0x0B,0xFA,0xF8,0x02,0xFF,0xFC,0x00,0x6F,0xE0,  // '@'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x02,0xFF,0x00,0x02,0xFF,0x00,0x02,0xFF,0x80,
+    0x03,0xEF,0x80,0x03,0xEF,0x80,0x0B,0xEB,0xC0,0x0B,0xCB,0xC0,0x0B,0xCB,0xE0,0x0F,0xC7,0xE0,
+    0x0F,0x83,0xE0,0x2F,0xFF,0xF0,0x2F,0xFF,0xF0,0x2F,0xFF,0xF8,0x3F,0xAA,0xF8,0x7E,0x00,0xFC,
+    0xBE,0x00,0xFC,0xBE,0x00,0xBD,0xFC,0x00,0xBE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'A'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xFE,0x80,0x3F,0xFF,0xE0,0x3F,0xFF,0xF4,0x3F,0x06,0xF8,
+    0x3F,0x01,0xFC,0x3F,0x00,0xFC,0x3F,0x01,0xF8,0x3F,0xAB,0xF4,0x3F,0xFF,0xD0,0x3F,0xFF,0xE0,
+    0x3F,0xAB,0xF8,0x3F,0x00,0xFC,0x3F,0x00,0xBD,0x3F,0x00,0xBE,0x3F,0x00,0xFE,0x3F,0x02,0xFD,
+    0x3F,0xFF,0xFC,0x3F,0xFF,0xF4,0x3F,0xFF,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'B'
+    0x00,0x00,0x00,0x00,0x06,0x40,0x00,0xBF,0xF4,0x02,0xFF,0xF8,0x07,0xFF,0xF8,0x0B,0xF8,0xB8,
+    0x0F,0xD0,0x04,0x2F,0xC0,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,
+    0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0xC0,0x00,0x0F,0xD0,0x04,0x0B,0xF4,0x68,
+    0x07,0xFF,0xF8,0x02,0xFF,0xF8,0x00,0xBF,0xF4,0x00,0x0A,0x80,0x00,0x00,0x00,0x00,0x00,0x00,  // 'C'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x2F,0xFA,0x00,0x3F,0xFF,0xD0,0x3F,0xFF,0xF0,0x3F,0xAB,0xF8,
+    0x3F,0x02,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xFE,0x3F,0x00,0xBE,0x3F,0x00,0xBE,0x3F,0x00,0xBE,
+    0x3F,0x00,0xBE,0x3F,0x00,0xBE,0x3F,0x00,0xFE,0x3F,0x00,0xFD,0x3F,0x02,0xFC,0x3F,0xAB,0xF8,
+    0x3F,0xFF,0xF0,0x3F,0xFF,0xD0,0x3F,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'D'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x2F,0xFF,0xF8,0x2F,0xFF,0xF8,0x2F,0xFF,0xF8,0x2F,0xAA,0xA4,
+    0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0xAA,0xA0,0x2F,0xFF,0xF0,0x2F,0xFF,0xF0,
+    0x2F,0xFF,0xF0,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0xAA,0xA4,
+    0x2F,0xFF,0xF8,0x2F,0xFF,0xF8,0x2F,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'E'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0xFC,0x2F,0xFF,0xFC,0x2F,0xFF,0xFC,0x2F,0xAA,0xA8,
+    0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0xAA,0xA4,0x2F,0xFF,0xF8,0x2F,0xFF,0xF8,
+    0x2F,0xFF,0xF4,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,
+    0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'F'
+    0x00,0x00,0x00,0x00,0x0A,0x40,0x00,0xBF,0xF4,0x02,0xFF,0xFC,0x0B,0xFF,0xFC,0x0F,0xE4,0x6C,
+    0x2F,0xD0,0x08,0x2F,0x80,0x00,0x3F,0x80,0x00,0x3F,0x00,0x00,0x3F,0x02,0xA8,0x3F,0x0B,0xFE,
+    0x3F,0x0B,0xFE,0x3F,0x0B,0xFE,0x3F,0x80,0xBE,0x2F,0x80,0xBE,0x2F,0xC0,0xBE,0x0F,0xE4,0xBE,
+    0x0B,0xFF,0xFE,0x02,0xFF,0xFD,0x00,0xBF,0xF4,0x00,0x1A,0x40,0x00,0x00,0x00,0x00,0x00,0x00,  // 'G'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x2F,0x01,0xF8,0x3F,0x02,0xF8,0x3F,0x02,0xF8,0x3F,0x02,0xF8,
+    0x3F,0x02,0xF8,0x3F,0x02,0xF8,0x3F,0x02,0xF8,0x3F,0xFF,0xF8,0x3F,0xFF,0xF8,0x3F,0xFF,0xF8,
+    0x3F,0xAA,0xF8,0x3F,0x02,0xF8,0x3F,0x02,0xF8,0x3F,0x02,0xF8,0x3F,0x02,0xF8,0x3F,0x02,0xF8,
+    0x3F,0x02,0xF8,0x3F,0x02,0xF8,0x3F,0x02,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'H'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x2F,0xFF,0xF8,0x2F,0xFF,0xF8,0x2F,0xFF,0xF8,0x1A,0xBE,0xA4,
+    0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,
+    0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,0x0A,0xBE,0xA0,
+    0x2F,0xFF,0xF8,0x2F,0xFF,0xF8,0x2F,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'I'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xE0,0x03,0xFF,0xF0,0x03,0xFF,0xF0,0x01,0xAB,0xF0,
+    0x00,0x03,0xF0,0x00,0x03,0xF0,0x00,0x03,0xF0,0x00,0x03,0xF0,0x00,0x03,0xF0,0x00,0x03,0xF0,
+    0x00,0x03,0xF0,0x00,0x03,0xF0,0x00,0x03,0xF0,0x00,0x03,0xF0,0x20,0x0B,0xF0,0x39,0x1B,0xE0,
+    0x3F,0xFF,0xE0,0x3F,0xFF,0xC0,0x2F,0xFF,0x40,0x01,0xA8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'J'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0xBE,0x3F,0x02,0xFC,0x3F,0x03,0xF4,0x3F,0x0B,0xE0,
+    0x3F,0x1F,0xC0,0x3F,0x2F,0x80,0x3F,0xBE,0x00,0x3F,0xFD,0x00,0x3F,0xFE,0x00,0x3F,0xFF,0x00,
+    0x3F,0xFF,0x80,0x3F,0xAF,0x80,0x3F,0x0F,0xD0,0x3F,0x0B,0xE0,0x3F,0x07,0xF0,0x3F,0x02,0xF8,
+    0x3F,0x02,0xFC,0x3F,0x00,0xFD,0x3F,0x00,0xBE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'K'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xC0,0x00,0x0F,0xC0,0x00,0x0F,0xC0,0x00,0x0F,0xC0,0x00,
+    0x0F,0xC0,0x00,0x0F,0xC0,0x00,0x0F,0xC0,0x00,0x0F,0xC0,0x00,0x0F,0xC0,0x00,0x0F,0xC0,0x00,
+    0x0F,0xC0,0x00,0x0F,0xC0,0x00,0x0F,0xC0,0x00,0x0F,0xC0,0x00,0x0F,0xC0,0x00,0x0F,0xEA,0xA8,
+    0x0F,0xFF,0xFC,0x0F,0xFF,0xFC,0x0F,0xFF,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'L'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x42,0xFC,0xBF,0x82,0xFC,0xBF,0x83,0xFC,0xBF,0xC3,0xFC,
+    0xBF,0xCB,0xFC,0xBF,0xEB,0xBC,0xBD,0xEB,0xBC,0xBD,0xEF,0xBC,0xBE,0xFE,0xBC,0xBE,0xBE,0xBC,
+    0xBE,0xBE,0xBC,0xBE,0xBC,0xBC,0xBE,0x28,0xBC,0xBE,0x00,0xBC,0xBE,0x00,0xBC,0xBE,0x00,0xBC,
+    0xBE,0x00,0xBC,0xBE,0x00,0xBC,0xBE,0x00,0xBC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'M'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x40,0xF8,0x3F,0x80,0xFC,0x3F,0xC0,0xFC,0x3F,0xD0,0xFC,
+    0x3F,0xE0,0xFC,0x3F,0xE0,0xFC,0x3E,0xF0,0xFC,0x3E,0xB8,0xFC,0x3E,0xB8,0xFC,0x3E,0x7C,0xFC,
+    0x3E,0x3D,0xFC,0x3E,0x2E,0xFC,0x3E,0x1E,0xFC,0x3E,0x0F,0xFC,0x3E,0x0B,0xFC,0x3E,0x0B,0xFC,
+    0x3E,0x07,0xFC,0x3E,0x03,0xFC,0x3E,0x02,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'N'
+    0x00,0x00,0x00,0x00,0x28,0x00,0x02,0xFF,0x80,0x0B,0xFF,0xD0,0x0F,0xFF,0xF0,0x2F,0xD7,0xF8,
+    0x2F,0x82,0xF8,0x3F,0x01,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xFC,
+    0x3F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xFC,0x2F,0x82,0xF8,0x2F,0xD7,0xF8,
+    0x0F,0xFF,0xF0,0x0B,0xFF,0xE0,0x02,0xFF,0x80,0x00,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'O'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x2F,0xFE,0x80,0x2F,0xFF,0xE0,0x2F,0xFF,0xF8,0x2F,0xAA,0xFC,
+    0x2F,0x81,0xFC,0x2F,0x80,0xFC,0x2F,0x80,0xFC,0x2F,0x81,0xFC,0x2F,0xAA,0xFC,0x2F,0xFF,0xF8,
+    0x2F,0xFF,0xE0,0x2F,0xFE,0x80,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,
+    0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'P'
+    0x00,0x00,0x00,0x00,0x69,0x00,0x02,0xFF,0x80,0x0B,0xFF,0xE0,0x0F,0xFF,0xF0,0x2F,0x83,0xF8,
+    0x2F,0x82,0xF8,0x3F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xFC,
+    0x3F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x41,0xFC,0x2F,0x82,0xF8,0x1F,0xEB,0xF4,
+    0x0B,0xFF,0xE0,0x07,0xFF,0xD0,0x01,0xBF,0xD0,0x00,0x07,0xF4,0x00,0x02,0xF4,0x00,0x00,0xD0,  // 'Q'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x2F,0xFE,0x40,0x3F,0xFF,0xE0,0x3F,0xFF,0xF4,0x3F,0xAB,0xF8,
+    0x3F,0x02,0xF8,0x3F,0x02,0xF8,0x3F,0x02,0xF8,0x3F,0x02,0xF8,0x3F,0xAF,0xF0,0x3F,0xFF,0xD0,
+    0x3F,0xFF,0x40,0x3F,0xAF,0xC0,0x3F,0x0B,0xE0,0x3F,0x07,0xE0,0x3F,0x03,0xF4,0x3F,0x02,0xF8,
+    0x3F,0x01,0xFC,0x3F,0x00,0xFE,0x3F,0x00,0xBE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'R'
+    0x00,0x00,0x00,0x00,0x28,0x00,0x02,0xFF,0x90,0x0B,0xFF,0xF0,0x2F,0xFF,0xF0,0x2F,0x80,0xB0,
+    0x3F,0x00,0x10,0x3F,0x00,0x00,0x3F,0x80,0x00,0x2F,0xF8,0x00,0x0F,0xFF,0x40,0x07,0xFF,0xD0,
+    0x00,0xBF,0xF0,0x00,0x1B,0xF8,0x00,0x02,0xF8,0x00,0x01,0xFC,0x20,0x01,0xFC,0x39,0x02,0xF8,
+    0x3F,0xFF,0xF8,0x3F,0xFF,0xE0,0x1B,0xFF,0x80,0x01,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'S'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xFF,0xFC,0x3F,0xFF,0xFC,0x3F,0xFF,0xFC,0x2A,0xBE,0xA8,
+    0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,
+    0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,
+    0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'T'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xFC,
+    0x3F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xFC,
+    0x3F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x41,0xFC,0x2F,0x82,0xF8,
+    0x2F,0xFF,0xF8,0x0B,0xFF,0xF0,0x06,0xFF,0xD0,0x00,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'U'
+    0x00,0x00,0x00,0x00,0x00,0x00,0xBE,0x00,0xBE,0x7E,0x00,0xBD,0x3F,0x00,0xFC,0x3F,0x00,0xFC,
+    0x2F,0x40,0xF8,0x2F,0x82,0xF8,0x2F,0x82,0xF8,0x0F,0x82,0xF0,0x0F,0xC3,0xF0,0x0B,0xC3,0xF0,
+    0x0B,0xD3,0xE0,0x0B,0xEB,0xE0,0x03,0xEB,0xD0,0x03,0xEB,0xC0,0x03,0xFB,0xC0,0x02,0xFF,0x80,
+    0x02,0xFF,0x80,0x02,0xFF,0x80,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'V'
+    0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x2F,0xF8,0x00,0x2F,0xFC,0x00,0x2F,0xBC,0x00,0x2F,
+    0xBC,0x00,0x3E,0xBC,0x7E,0x3E,0xBC,0xBE,0x3E,0xBC,0xBE,0x3E,0x7D,0xBF,0x3E,0x3E,0xFF,0x3E,
+    0x3E,0xEB,0x3C,0x3E,0xEB,0x7C,0x3F,0xEB,0xFC,0x2F,0xEB,0xFC,0x2F,0xD3,0xFC,0x2F,0xC3,0xF8,
+    0x2F,0xC2,0xF8,0x2F,0xC2,0xF8,0x1F,0x82,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'W'
+    0x00,0x00,0x00,0x00,0x00,0x00,0xBE,0x00,0xBE,0x3F,0x00,0xFD,0x2F,0x82,0xF8,0x0F,0xC2,0xF4,
+    0x0B,0xE7,0xE0,0x07,0xEB,0xE0,0x02,0xFF,0xC0,0x01,0xFF,0x80,0x00,0xFF,0x00,0x00,0xBE,0x00,
+    0x00,0xFF,0x00,0x02,0xFF,0x80,0x02,0xFF,0xC0,0x07,0xEB,0xE0,0x0B,0xD7,0xF0,0x1F,0xC2,0xF4,
+    0x2F,0x81,0xF8,0x3F,0x00,0xFD,0xBE,0x00,0xBE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'X'
+    0x00,0x00,0x00,0x00,0x00,0x00,0xBE,0x00,0x7F,0xBE,0x00,0xBE,0x3F,0x40,0xFC,0x2F,0x82,0xF8,
+    0x1F,0xC2,0xF8,0x0B,0xD7,0xF0,0x0B,0xEB,0xE0,0x03,0xFF,0xD0,0x02,0xFF,0x80,0x01,0xFF,0x80,
+    0x00,0xFF,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,
+    0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'Y'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x2F,0xFF,0xFD,0x2F,0xFF,0xFE,0x2F,0xFF,0xFE,0x1A,0xAA,0xFD,
+    0x00,0x03,0xF8,0x00,0x0B,0xF0,0x00,0x0F,0xE0,0x00,0x2F,0xC0,0x00,0x3F,0x80,0x00,0xBF,0x00,
+    0x00,0xFD,0x00,0x02,0xF8,0x00,0x03,0xF4,0x00,0x0B,0xE0,0x00,0x1F,0xD0,0x00,0x2F,0xAA,0xA8,
+    0x3F,0xFF,0xFE,0x3F,0xFF,0xFE,0x3F,0xFF,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'Z'
+    0x00,0x00,0x00,0x00,0xFF,0xC0,0x00,0xFF,0xC0,0x00,0xFE,0x80,0x00,0xFC,0x00,0x00,0xFC,0x00,
+    0x00,0xFC,0x00,0x00,0xFC,0x00,0x00,0xFC,0x00,0x00,0xFC,0x00,0x00,0xFC,0x00,0x00,0xFC,0x00,
+    0x00,0xFC,0x00,0x00,0xFC,0x00,0x00,0xFC,0x00,0x00,0xFC,0x00,0x00,0xFC,0x00,0x00,0xFC,0x00,
+    0x00,0xFC,0x00,0x00,0xFC,0x00,0x00,0xFF,0xC0,0x00,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,  // '['
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2E,0x00,0x00,0x1F,0x00,0x00,0x0F,0x80,0x00,
+    0x0B,0x80,0x00,0x03,0xD0,0x00,0x02,0xE0,0x00,0x01,0xF0,0x00,0x00,0xB8,0x00,0x00,0x7C,0x00,
+    0x00,0x3E,0x00,0x00,0x2E,0x00,0x00,0x0F,0x40,0x00,0x0B,0x80,0x00,0x07,0xC0,0x00,0x02,0xE0,
+    0x00,0x01,0xF0,0x00,0x00,0xF8,0x00,0x00,0xBC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // barra invertida
+    0x00,0x00,0x00,0x02,0xFF,0x40,0x03,0xFF,0x80,0x01,0xAF,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,
+    0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,
+    0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,
+    0x00,0x2F,0x80,0x00,0x2F,0x80,0x02,0xFF,0x80,0x03,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x00,  // ']'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0xBE,0x00,0x01,0xFF,0x40,0x02,0xFF,0x80,0x07,0xEB,0xE0,0x0F,0xC3,0xF0,0x2F,0x41,0xF8,
+    0x7D,0x00,0x7D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '^'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0xAA,0xAA,0x00,0x00,0x00,0x00,0x00,0x00,  // '_'
+    0x00,0x00,0x00,0x00,0x0A,0x00,0x00,0x2F,0x00,0x00,0x3E,0x00,0x00,0x7E,0x00,0x00,0xBE,0x00,
+    0x00,0xFC,0x00,0x00,0xFC,0x00,0x00,0xFC,0x00,0x00,0xA8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '`'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x01,0xAA,0x00,0x0B,0xFF,0xD0,0x0F,0xFF,0xF0,0x0E,0xAA,0xF8,0x14,0x01,0xF8,0x00,0xAA,0xF8,
+    0x0B,0xFF,0xF8,0x2F,0xFF,0xF8,0x3F,0xEA,0xF8,0x7F,0x01,0xF8,0xBF,0x02,0xF8,0x7F,0x02,0xF8,
+    0x3F,0x8B,0xF8,0x2F,0xFF,0xF8,0x0B,0xFC,0xF8,0x01,0xA0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'a'
+    0x00,0x00,0x00,0x1A,0x00,0x00,0x2F,0x00,0x00,0x2F,0x00,0x00,0x2F,0x00,0x00,0x2F,0x00,0x00,
+    0x2F,0x0A,0x40,0x2F,0x3F,0xD0,0x2F,0xBF,0xF0,0x2F,0xEB,0xF8,0x2F,0xC2,0xF8,0x2F,0x80,0xFC,
+    0x2F,0x80,0xFC,0x2F,0x00,0xFC,0x2F,0x00,0xFC,0x2F,0x80,0xFC,0x2F,0x80,0xFC,0x2F,0xC2,0xF8,
+    0x2F,0xEB,0xF8,0x2F,0xBF,0xF0,0x2F,0x3F,0xD0,0x00,0x0A,0x40,0x00,0x00,0x00,0x00,0x00,0x00,  // 'b'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x2A,0x40,0x01,0xFF,0xE0,0x07,0xFF,0xF0,0x0B,0xFA,0xB0,0x0F,0xD0,0x24,0x2F,0x80,0x00,
+    0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x0F,0xD0,0x20,
+    0x0B,0xFA,0xF0,0x07,0xFF,0xF0,0x01,0xFF,0xE0,0x00,0x2A,0x40,0x00,0x00,0x00,0x00,0x00,0x00,  // 'c'
+    0x00,0x00,0x00,0x00,0x01,0xA4,0x00,0x02,0xF8,0x00,0x02,0xF8,0x00,0x02,0xF8,0x00,0x02,0xF8,
+    0x01,0xA2,0xF8,0x0B,0xFA,0xF8,0x1F,0xFF,0xF8,0x2F,0xEF,0xF8,0x3F,0x47,0xF8,0x3F,0x02,0xF8,
+    0x7E,0x02,0xF8,0xBE,0x02,0xF8,0xBE,0x02,0xF8,0x7E,0x02,0xF8,0x3F,0x02,0xF8,0x3F,0x47,0xF8,
+    0x2F,0xEF,0xF8,0x1F,0xFF,0xF8,0x0B,0xFA,0xF8,0x01,0xA0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'd'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x6A,0x00,0x02,0xFF,0xD0,0x0B,0xFF,0xF0,0x1F,0xEB,0xF8,0x2F,0x41,0xFC,0x3F,0x00,0xFC,
+    0x3F,0xFF,0xFD,0x3F,0xFF,0xFE,0x3F,0xFF,0xFE,0x3F,0x00,0x00,0x3F,0x00,0x00,0x2F,0x80,0x1C,
+    0x1F,0xEA,0xFC,0x0B,0xFF,0xFC,0x02,0xFF,0xF8,0x00,0x6A,0x40,0x00,0x00,0x00,0x00,0x00,0x00,  // 'e'
+    0x00,0x00,0x00,0x00,0x1A,0xA4,0x00,0x3F,0xF8,0x00,0xBF,0xF8,0x00,0xBE,0x00,0x00,0xFC,0x00,
+    0x00,0xFD,0x00,0x2F,0xFF,0xF8,0x2F,0xFF,0xF8,0x1F,0xFF,0xF4,0x00,0xFC,0x00,0x00,0xFC,0x00,
+    0x00,0xFC,0x00,0x00,0xFC,0x00,0x00,0xFC,0x00,0x00,0xFC,0x00,0x00,0xFC,0x00,0x00,0xFC,0x00,
+    0x00,0xFC,0x00,0x00,0xFC,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'f'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x01,0xA4,0x00,0x07,0xFD,0xF8,0x1F,0xFF,0xF8,0x2F,0x9B,0xF8,0x3F,0x42,0xF8,0x3F,0x02,0xF8,
+    0x3F,0x02,0xF8,0x3E,0x01,0xF8,0x3F,0x02,0xF8,0x3F,0x42,0xF8,0x2F,0xEB,0xF8,0x0F,0xFF,0xF8,
+    0x06,0xF8,0xF8,0x00,0x02,0xF8,0x08,0x02,0xF8,0x0F,0xFF,0xF4,0x0F,0xFF,0xE0,0x0B,0xFE,0x40,  // 'g'
+    0x00,0x00,0x00,0x1A,0x40,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,
+    0x2F,0x8A,0x40,0x2F,0xAF,0xD0,0x2F,0xFF,0xF0,0x2F,0xEB,0xF4,0x2F,0xC2,0xF8,0x2F,0x82,0xF8,
+    0x2F,0x82,0xF8,0x2F,0x82,0xF8,0x2F,0x82,0xF8,0x2F,0x82,0xF8,0x2F,0x82,0xF8,0x2F,0x82,0xF8,
+    0x2F,0x82,0xF8,0x2F,0x82,0xF8,0x2F,0x82,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'h'
+    0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x29,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x0F,0xFF,0x00,0x0F,0xFF,0x00,0x0B,0xFF,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,
+    0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,
+    0x2F,0xFF,0xFD,0x2F,0xFF,0xFE,0x2F,0xFF,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'i'
+    0x00,0x1A,0x00,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x1A,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x0B,0xFF,0x80,0x0B,0xFF,0x80,0x06,0xAF,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,
+    0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,
+    0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x3F,0x00,0x1A,0xFF,0x00,0x2F,0xFE,0x00,0x2F,0xF8,0x00,  // 'j'
+    0x00,0x00,0x00,0x1A,0x40,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,
+    0x2F,0x80,0x00,0x2F,0x82,0xFC,0x2F,0x87,0xF4,0x2F,0x8F,0xD0,0x2F,0xAF,0x80,0x2F,0xFE,0x00,
+    0x2F,0xFE,0x00,0x2F,0xFF,0x00,0x2F,0xEF,0x80,0x2F,0x8F,0xC0,0x2F,0x8B,0xE0,0x2F,0x87,0xF0,
+    0x2F,0x82,0xF8,0x2F,0x81,0xFC,0x2F,0x80,0xBE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'k'
+    0x00,0x00,0x00,0x6A,0xA4,0x00,0xBF,0xF8,0x00,0xBF,0xF8,0x00,0x02,0xF8,0x00,0x02,0xF8,0x00,
+    0x02,0xF8,0x00,0x02,0xF8,0x00,0x02,0xF8,0x00,0x02,0xF8,0x00,0x02,0xF8,0x00,0x02,0xF8,0x00,
+    0x02,0xF8,0x00,0x02,0xF8,0x00,0x02,0xF8,0x00,0x02,0xF8,0x00,0x02,0xF8,0x00,0x01,0xFC,0x00,
+    0x00,0xFF,0xF8,0x00,0xBF,0xF8,0x00,0x2F,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'l'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0xA1,0xA0,0xBE,0xFB,0xF8,0xBF,0xFF,0xFC,0xBE,0xBE,0xBC,0xBD,0xBD,0x7C,0xBC,0x7C,0x3E,
+    0xBC,0xBC,0x3E,0xBC,0xBC,0x3E,0xBC,0xBC,0x3E,0xBC,0xBC,0x3E,0xBC,0xBC,0x3E,0xBC,0xBC,0x3E,
+    0xBC,0xBC,0x3E,0xBC,0xBC,0x3E,0xBC,0x7C,0x3D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'm'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x0A,0x40,0x2F,0xAF,0xD0,0x2F,0xFF,0xF0,0x2F,0xEB,0xF4,0x2F,0xC2,0xF8,0x2F,0x82,0xF8,
+    0x2F,0x82,0xF8,0x2F,0x82,0xF8,0x2F,0x82,0xF8,0x2F,0x82,0xF8,0x2F,0x82,0xF8,0x2F,0x82,0xF8,
+    0x2F,0x82,0xF8,0x2F,0x82,0xF8,0x2F,0x82,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'n'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0xA9,0x00,0x02,0xFF,0x80,0x0B,0xFF,0xE0,0x1F,0xEB,0xF4,0x2F,0x82,0xF8,0x3F,0x00,0xFC,
+    0x3F,0x00,0xFC,0x3E,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x01,0xFC,0x2F,0x82,0xF8,
+    0x1F,0xEB,0xF4,0x0B,0xFF,0xE0,0x02,0xFF,0x80,0x00,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'o'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x0A,0x40,0x2F,0x7F,0xE0,0x2F,0xFF,0xF4,0x2F,0xE6,0xF8,0x2F,0x81,0xFC,0x2F,0x80,0xFC,
+    0x2F,0x80,0xFC,0x2F,0x80,0xFC,0x2F,0x80,0xFC,0x2F,0x81,0xFC,0x2F,0xEA,0xF8,0x2F,0xFF,0xF4,
+    0x2F,0x7F,0xE0,0x2F,0x9A,0x40,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,  // 'p'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x02,0xA0,0x00,0x0B,0xFA,0xF8,0x2F,0xFF,0xF8,0x2F,0x8B,0xF8,0x3F,0x02,0xF8,0x7E,0x02,0xF8,
+    0xBE,0x02,0xF8,0xBE,0x02,0xF8,0x7E,0x02,0xF8,0x3F,0x02,0xF8,0x3F,0xAB,0xF8,0x2F,0xFF,0xF8,
+    0x0B,0xFA,0xF8,0x01,0xA2,0xF8,0x00,0x02,0xF8,0x00,0x02,0xF8,0x00,0x02,0xF8,0x00,0x02,0xF8,  // 'q'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x01,0xA4,0x0B,0xEB,0xFC,0x0B,0xEF,0xFC,0x0B,0xFF,0xFC,0x0B,0xF8,0x05,0x0B,0xF0,0x00,
+    0x0B,0xE0,0x00,0x0B,0xE0,0x00,0x0B,0xE0,0x00,0x0B,0xE0,0x00,0x0B,0xE0,0x00,0x0B,0xE0,0x00,
+    0x0B,0xE0,0x00,0x0B,0xE0,0x00,0x0B,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'r'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0xAA,0x40,0x07,0xFF,0xE0,0x0F,0xFF,0xE0,0x2F,0xAA,0xA0,0x2F,0x80,0x10,0x2F,0x90,0x00,
+    0x1F,0xFA,0x00,0x0B,0xFF,0xD0,0x02,0xFF,0xF0,0x00,0x2B,0xF4,0x00,0x02,0xF8,0x14,0x02,0xF8,
+    0x2E,0xAB,0xF4,0x2F,0xFF,0xF0,0x1F,0xFF,0xD0,0x01,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 's'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xF8,0x00,0x02,0xF8,0x00,0x02,0xF8,0x00,
+    0x02,0xF8,0x00,0x3F,0xFF,0xF8,0x3F,0xFF,0xF8,0x2F,0xFF,0xF4,0x02,0xF8,0x00,0x02,0xF8,0x00,
+    0x02,0xF8,0x00,0x02,0xF8,0x00,0x02,0xF8,0x00,0x02,0xF8,0x00,0x02,0xF8,0x00,0x01,0xF8,0x00,
+    0x00,0xFF,0xF4,0x00,0xBF,0xF8,0x00,0x2F,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 't'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x2F,0x82,0xF8,0x2F,0x82,0xF8,0x2F,0x82,0xF8,0x2F,0x82,0xF8,0x2F,0x82,0xF8,
+    0x2F,0x82,0xF8,0x2F,0x82,0xF8,0x2F,0x82,0xF8,0x2F,0x82,0xF8,0x2F,0x82,0xF8,0x2F,0x82,0xF8,
+    0x1F,0xEB,0xF8,0x0F,0xFF,0xF8,0x07,0xFA,0xF8,0x01,0xA0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'u'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x3F,0x00,0xFD,0x3F,0x00,0xFC,0x2F,0x41,0xF8,0x2F,0x82,0xF8,0x0F,0x82,0xF0,
+    0x0F,0xC3,0xF0,0x0B,0xC3,0xE0,0x0B,0xEB,0xE0,0x03,0xEB,0xD0,0x03,0xEB,0xC0,0x02,0xFF,0x80,
+    0x02,0xFF,0x80,0x01,0xFF,0x40,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'v'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0xF8,0x00,0x2F,0xF8,0x00,0x2F,0xB8,0x00,0x2E,0xBC,0x28,0x3E,0xBC,0xBE,0x3E,
+    0x7C,0xBE,0x3E,0x3D,0xBE,0x3C,0x3E,0xFF,0xBC,0x3E,0xEB,0xBC,0x2E,0xEB,0xB8,0x2F,0xEB,0xF8,
+    0x2F,0xD3,0xF8,0x1F,0xC3,0xF8,0x0F,0xC2,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'w'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x2F,0x82,0xFC,0x1F,0xC2,0xF8,0x0B,0xE7,0xF0,0x07,0xEB,0xD0,0x02,0xFF,0x80,
+    0x00,0xFF,0x40,0x00,0xBE,0x00,0x00,0xBF,0x00,0x02,0xFF,0x80,0x03,0xFB,0xD0,0x0B,0xEB,0xE0,
+    0x0F,0xC3,0xF4,0x2F,0x82,0xF8,0x7F,0x40,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'x'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x7E,0x00,0xBE,0x3F,0x00,0xFC,0x2F,0x82,0xF8,0x1F,0x82,0xF4,0x0F,0xC3,0xF0,
+    0x0B,0xE7,0xE0,0x07,0xEB,0xE0,0x03,0xFB,0xC0,0x02,0xFF,0x80,0x00,0xFF,0x80,0x00,0xBF,0x00,
+    0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xFC,0x00,0x2A,0xF8,0x00,0x3F,0xF4,0x00,0x3F,0x90,0x00,  // 'y'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x0F,0xFF,0xF8,0x0F,0xFF,0xF8,0x0F,0xFB,0xF8,0x00,0x07,0xF4,0x00,0x0B,0xE0,
+    0x00,0x2F,0x80,0x00,0x7F,0x40,0x00,0xFE,0x00,0x02,0xF8,0x00,0x07,0xF4,0x00,0x0F,0xD0,0x00,
+    0x2F,0xFF,0xF8,0x2F,0xFF,0xF8,0x2F,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'z'
+    0x00,0x00,0x00,0x00,0x0A,0xA4,0x00,0x2F,0xF8,0x00,0x3F,0xA4,0x00,0xBE,0x00,0x00,0xBE,0x00,
+    0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,0x02,0xFC,0x00,0x2F,0xF4,0x00,
+    0x2F,0xF8,0x00,0x01,0xFC,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,
+    0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0x3F,0xA4,0x00,0x2F,0xF8,0x00,0x0A,0xA4,0x00,0x00,0x00,  // '{'
+    0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,
+    0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,
+    0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,
+    0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '|'
+    0x00,0x00,0x00,0x1A,0xA0,0x00,0x2F,0xF8,0x00,0x1A,0xFD,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,
+    0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0x3F,0x80,0x00,0x1F,0xF8,
+    0x00,0x1F,0xF8,0x00,0x3F,0x40,0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,
+    0x00,0xBE,0x00,0x00,0xBE,0x00,0x0A,0xFD,0x00,0x2F,0xF8,0x00,0x1A,0xA0,0x00,0x00,0x00,0x00,  // '}'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x02,0x00,0x00,0x1F,0xD0,0x00,0x3F,0xF0,0x08,0xBE,0xF8,0x1E,0xB8,0x7D,0x2E,
+    0xB0,0x2F,0xBD,0x20,0x1F,0xF8,0x00,0x07,0xE0,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '~'
+};
+
+const AAFont fontAA24 = { fontAA24Table, 12, 24, 0 };
+
+#endif // !FONT_SUBSET
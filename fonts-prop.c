@@ -0,0 +1,300 @@
+/// fonts-prop.c - font5x7 proporcional com kerning (formato em fonts.h)
+///
+/// Gerado por sim/fontprop (make -C sim prop) a partir de font5x7 em
+/// fonts.c. Não editar à mão.
+#include <stdint.h>
+#include "fonts.h"
+
+static const uint8_t propCols[1021] = {
+    0x00, 0x00,                   // ' '
+    0x5F,                         // '!'
+    0x07, 0x00, 0x07,             // '"'
+    0x14, 0x7F, 0x14, 0x7F, 0x14, // '#'
+    0x24, 0x2A, 0x7F, 0x2A, 0x12, // '$'
+    0x23, 0x13, 0x08, 0x64, 0x62, // '%'
+    0x36, 0x49, 0x56, 0x20, 0x50, // '&'
+    0x08, 0x07, 0x03,             // '''
+    0x1C, 0x22, 0x41,             // '('
+    0x41, 0x22, 0x1C,             // ')'
+    0x2A, 0x1C, 0x7F, 0x1C, 0x2A, // '*'
+    0x08, 0x08, 0x3E, 0x08, 0x08, // '+'
+    0x80, 0x70, 0x30,             // ','
+    0x08, 0x08, 0x08, 0x08, 0x08, // '-'
+    0x60, 0x60,                   // '.'
+    0x20, 0x10, 0x08, 0x04, 0x02, // '/'
+    0x3E, 0x51, 0x49, 0x45, 0x3E, // '0'
+    0x42, 0x7F, 0x40,             // '1'
+    0x72, 0x49, 0x49, 0x49, 0x46, // '2'
+    0x21, 0x41, 0x49, 0x4D, 0x33, // '3'
+    0x18, 0x14, 0x12, 0x7F, 0x10, // '4'
+    0x27, 0x45, 0x45, 0x45, 0x39, // '5'
+    0x3C, 0x4A, 0x49, 0x49, 0x31, // '6'
+    0x41, 0x21, 0x11, 0x09, 0x07, // '7'
+    0x36, 0x49, 0x49, 0x49, 0x36, // '8'
+    0x46, 0x49, 0x49, 0x29, 0x1E, // '9'
+    0x14,                         // ':'
+    0x40, 0x34,                   // ';'
+    0x08, 0x14, 0x22, 0x41,       // '<'
+    0x14, 0x14, 0x14, 0x14, 0x14, // '='
+    0x41, 0x22, 0x14, 0x08,       // '>'
+    0x02, 0x01, 0x59, 0x09, 0x06, // '?'
+    0x3E, 0x41, 0x5D, 0x59, 0x4E, // '@'
+    0x7C, 0x12, 0x11, 0x12, 0x7C, // 'A'
+    0x7F, 0x49, 0x49, 0x49, 0x36, // 'B'
+    0x3E, 0x41, 0x41, 0x41, 0x22, // 'C'
+    0x7F, 0x41, 0x41, 0x41, 0x3E, // 'D'
+    0x7F, 0x49, 0x49, 0x49, 0x41, // 'E'
+    0x7F, 0x09, 0x09, 0x09, 0x01, // 'F'
+    0x3E, 0x41, 0x41, 0x51, 0x73, // 'G'
+    0x7F, 0x08, 0x08, 0x08, 0x7F, // 'H'
+    0x41, 0x7F, 0x41,             // 'I'
+    0x20, 0x40, 0x41, 0x3F, 0x01, // 'J'
+    0x7F, 0x08, 0x14, 0x22, 0x41, // 'K'
+    0x7F, 0x40, 0x40, 0x40, 0x40, // 'L'
+    0x7F, 0x02, 0x1C, 0x02, 0x7F, // 'M'
+    0x7F, 0x04, 0x08, 0x10, 0x7F, // 'N'
+    0x3E, 0x41, 0x41, 0x41, 0x3E, // 'O'
+    0x7F, 0x09, 0x09, 0x09, 0x06, // 'P'
+    0x3E, 0x41, 0x51, 0x21, 0x5E, // 'Q'
+    0x7F, 0x09, 0x19, 0x29, 0x46, // 'R'
+    0x26, 0x49, 0x49, 0x49, 0x32, // 'S'
+    0x03, 0x01, 0x7F, 0x01, 0x03, // 'T'
+    0x3F, 0x40, 0x40, 0x40, 0x3F, // 'U'
+    0x1F, 0x20, 0x40, 0x20, 0x1F, // 'V'
+    0x3F, 0x40, 0x38, 0x40, 0x3F, // 'W'
+    0x63, 0x14, 0x08, 0x14, 0x63, // 'X'
+    0x03, 0x04, 0x78, 0x04, 0x03, // 'Y'
+    0x61, 0x59, 0x49, 0x4D, 0x43, // 'Z'
+    0x7F, 0x41, 0x41, 0x41,       // '['
+    0x02, 0x04, 0x08, 0x10, 0x20, // barra invertida
+    0x41, 0x41, 0x41, 0x7F,       // ']'
+    0x04, 0x02, 0x01, 0x02, 0x04, // '^'
+    0x40, 0x40, 0x40, 0x40, 0x40, // '_'
+    0x03, 0x07, 0x08,             // '`'
+    0x20, 0x54, 0x54, 0x78, 0x40, // 'a'
+    0x7F, 0x28, 0x44, 0x44, 0x38, // 'b'
+    0x38, 0x44, 0x44, 0x44, 0x28, // 'c'
+    0x38, 0x44, 0x44, 0x28, 0x7F, // 'd'
+    0x38, 0x54, 0x54, 0x54, 0x18, // 'e'
+    0x08, 0x7E, 0x09, 0x02,       // 'f'
+    0x18, 0xA4, 0xA4, 0x9C, 0x78, // 'g'
+    0x7F, 0x08, 0x04, 0x04, 0x78, // 'h'
+    0x44, 0x7D, 0x40,             // 'i'
+    0x20, 0x40, 0x40, 0x3D,       // 'j'
+    0x7F, 0x10, 0x28, 0x44,       // 'k'
+    0x41, 0x7F, 0x40,             // 'l'
+    0x7C, 0x04, 0x78, 0x04, 0x78, // 'm'
+    0x7C, 0x08, 0x04, 0x04, 0x78, // 'n'
+    0x38, 0x44, 0x44, 0x44, 0x38, // 'o'
+    0xFC, 0x18, 0x24, 0x24, 0x18, // 'p'
+    0x18, 0x24, 0x24, 0x18, 0xFC, // 'q'
+    0x7C, 0x08, 0x04, 0x04, 0x08, // 'r'
+    0x48, 0x54, 0x54, 0x54, 0x24, // 's'
+    0x04, 0x04, 0x3F, 0x44, 0x24, // 't'
+    0x3C, 0x40, 0x40, 0x20, 0x7C, // 'u'
+    0x1C, 0x20, 0x40, 0x20, 0x1C, // 'v'
+    0x3C, 0x40, 0x30, 0x40, 0x3C, // 'w'
+    0x44, 0x28, 0x10, 0x28, 0x44, // 'x'
+    0x4C, 0x90, 0x90, 0x90, 0x7C, // 'y'
+    0x44, 0x64, 0x54, 0x4C, 0x44, // 'z'
+    0x08, 0x36, 0x41,             // '{'
+    0x77,                         // '|'
+    0x41, 0x36, 0x08,             // '}'
+    0x02, 0x01, 0x02, 0x04, 0x02, // '~'
+    0x3C, 0x26, 0x23, 0x26, 0x3C, // 0x7F
+    0x1E, 0xA1, 0xA1, 0x61, 0x12, // 0x80
+    0x3A, 0x40, 0x40, 0x20, 0x7A, // 0x81
+    0x38, 0x54, 0x54, 0x55, 0x59, // 0x82
+    0x21, 0x55, 0x55, 0x79, 0x41, // 0x83
+    0x22, 0x54, 0x54, 0x78, 0x42, // 0x84
+    0x21, 0x55, 0x54, 0x78, 0x40, // 0x85
+    0x20, 0x54, 0x55, 0x79, 0x40, // 0x86
+    0x0C, 0x1E, 0x52, 0x72, 0x12, // 0x87
+    0x39, 0x55, 0x55, 0x55, 0x59, // 0x88
+    0x39, 0x54, 0x54, 0x54, 0x59, // 0x89
+    0x39, 0x55, 0x54, 0x54, 0x58, // 0x8A
+    0x45, 0x7C, 0x41,             // 0x8B
+    0x02, 0x45, 0x7D, 0x42,       // 0x8C
+    0x01, 0x45, 0x7C, 0x40,       // 0x8D
+    0x7D, 0x12, 0x11, 0x12, 0x7D, // 0x8E
+    0xF0, 0x28, 0x25, 0x28, 0xF0, // 0x8F
+    0x7C, 0x54, 0x55, 0x45,       // 0x90
+    0x20, 0x54, 0x54, 0x7C, 0x54, // 0x91
+    0x7C, 0x0A, 0x09, 0x7F, 0x49, // 0x92
+    0x32, 0x49, 0x49, 0x49, 0x32, // 0x93
+    0x3A, 0x44, 0x44, 0x44, 0x3A, // 0x94
+    0x32, 0x4A, 0x48, 0x48, 0x30, // 0x95
+    0x3A, 0x41, 0x41, 0x21, 0x7A, // 0x96
+    0x3A, 0x42, 0x40, 0x20, 0x78, // 0x97
+    0x9D, 0xA0, 0xA0, 0x7D,       // 0x98
+    0x3D, 0x42, 0x42, 0x42, 0x3D, // 0x99
+    0x3D, 0x40, 0x40, 0x40, 0x3D, // 0x9A
+    0x3C, 0x24, 0xFF, 0x24, 0x24, // 0x9B
+    0x48, 0x7E, 0x49, 0x43, 0x66, // 0x9C
+    0x2B, 0x2F, 0xFC, 0x2F, 0x2B, // 0x9D
+    0xFF, 0x09, 0x29, 0xF6, 0x20, // 0x9E
+    0xC0, 0x88, 0x7E, 0x09, 0x03, // 0x9F
+    0x00, 0x00,                   // ' '
+    0x7B,                         // '¡'
+    0x3C, 0x24, 0xFF, 0x24, 0x24, // '¢'
+    0x48, 0x7E, 0x49, 0x43, 0x66, // '£'
+    0x5A, 0x3C, 0xE7, 0x3C, 0x5A, // '¤'
+    0x2B, 0x2F, 0xFC, 0x2F, 0x2B, // '¥'
+    0x77,                         // '¦'
+    0x66, 0x89, 0x95, 0x6A,       // '§'
+    0x07, 0x00, 0x07,             // '¨'
+    0x02, 0x01, 0x59, 0x09, 0x06, // '©'
+    0x26, 0x29, 0x29, 0x2F, 0x28, // 'ª'
+    0x08, 0x14, 0x2A, 0x14, 0x22, // '«'
+    0x08, 0x08, 0x08, 0x08, 0x38, // '¬'
+    0x08, 0x08, 0x08, 0x08, 0x08, // '­'
+    0x02, 0x01, 0x59, 0x09, 0x06, // '®'
+    0x08, 0x08, 0x08, 0x08, 0x08, // '¯'
+    0x06, 0x0F, 0x09, 0x0F, 0x06, // '°'
+    0x44, 0x44, 0x5F, 0x44, 0x44, // '±'
+    0x19, 0x1D, 0x17, 0x12,       // '²'
+    0x21, 0x41, 0x49, 0x4D, 0x33, // '³'
+    0x08, 0x07, 0x03,             // '´'
+    0x40, 0x7E, 0x20, 0x1E, 0x20, // 'µ'
+    0x06, 0x09, 0x7F, 0x01, 0x7F, // '¶'
+    0x10, 0x10,                   // '·'
+    0x80, 0x70, 0x30,             // '¸'
+    0x42, 0x7F, 0x40,             // '¹'
+    0x26, 0x29, 0x29, 0x29, 0x26, // 'º'
+    0x22, 0x14, 0x2A, 0x14, 0x08, // '»'
+    0x2F, 0x10, 0x28, 0x34, 0xFA, // '¼'
+    0x2F, 0x10, 0xC8, 0xAC, 0xBA, // '½'
+    0x02, 0x01, 0x59, 0x09, 0x06, // '¾'
+    0x30, 0x48, 0x4D, 0x40, 0x20, // '¿'
+    0x78, 0x15, 0x16, 0x14, 0x78, // 'À'
+    0x78, 0x14, 0x16, 0x15, 0x78, // 'Á'
+    0x78, 0x16, 0x15, 0x16, 0x78, // 'Â'
+    0x7A, 0x15, 0x15, 0x16, 0x79, // 'Ã'
+    0x7D, 0x12, 0x11, 0x12, 0x7D, // 'Ä'
+    0xF0, 0x28, 0x25, 0x28, 0xF0, // 'Å'
+    0x7C, 0x0A, 0x09, 0x7F, 0x49, // 'Æ'
+    0x1E, 0xA1, 0xA1, 0x61, 0x12, // 'Ç'
+    0x7F, 0x49, 0x49, 0x49, 0x41, // 'È'
+    0x7C, 0x54, 0x55, 0x45,       // 'É'
+    0x7C, 0x56, 0x55, 0x56, 0x44, // 'Ê'
+    0x7F, 0x49, 0x49, 0x49, 0x41, // 'Ë'
+    0x41, 0x7F, 0x41,             // 'Ì'
+    0x44, 0x7E, 0x45,             // 'Í'
+    0x41, 0x7F, 0x41,             // 'Î'
+    0x41, 0x7F, 0x41,             // 'Ï'
+    0x7F, 0x41, 0x41, 0x41, 0x3E, // 'Ð'
+    0x7D, 0x0D, 0x19, 0x31, 0x7D, // 'Ñ'
+    0x3E, 0x41, 0x41, 0x41, 0x3E, // 'Ò'
+    0x38, 0x44, 0x46, 0x45, 0x38, // 'Ó'
+    0x38, 0x46, 0x45, 0x46, 0x38, // 'Ô'
+    0x3A, 0x45, 0x45, 0x46, 0x39, // 'Õ'
+    0x3D, 0x42, 0x42, 0x42, 0x3D, // 'Ö'
+    0x44, 0x28, 0x10, 0x28, 0x44, // '×'
+    0x3E, 0x41, 0x41, 0x41, 0x3E, // 'Ø'
+    0x3F, 0x40, 0x40, 0x40, 0x3F, // 'Ù'
+    0x3C, 0x40, 0x42, 0x41, 0x3C, // 'Ú'
+    0x3F, 0x40, 0x40, 0x40, 0x3F, // 'Û'
+    0x3D, 0x40, 0x40, 0x40, 0x3D, // 'Ü'
+    0x03, 0x04, 0x78, 0x04, 0x03, // 'Ý'
+    0x7F, 0x09, 0x09, 0x09, 0x06, // 'Þ'
+    0xFC, 0x4A, 0x4A, 0x4A, 0x34, // 'ß'
+    0x21, 0x55, 0x54, 0x78, 0x40, // 'à'
+    0x20, 0x54, 0x54, 0x79, 0x41, // 'á'
+    0x21, 0x55, 0x55, 0x79, 0x41, // 'â'
+    0x22, 0x55, 0x55, 0x7A, 0x41, // 'ã'
+    0x22, 0x54, 0x54, 0x78, 0x42, // 'ä'
+    0x20, 0x54, 0x55, 0x79, 0x40, // 'å'
+    0x20, 0x54, 0x54, 0x7C, 0x54, // 'æ'
+    0x0C, 0x1E, 0x52, 0x72, 0x12, // 'ç'
+    0x39, 0x55, 0x54, 0x54, 0x58, // 'è'
+    0x38, 0x54, 0x54, 0x55, 0x59, // 'é'
+    0x39, 0x55, 0x55, 0x55, 0x59, // 'ê'
+    0x39, 0x54, 0x54, 0x54, 0x59, // 'ë'
+    0x01, 0x45, 0x7C, 0x40,       // 'ì'
+    0x44, 0x7D, 0x41,             // 'í'
+    0x02, 0x45, 0x7D, 0x42,       // 'î'
+    0x45, 0x7C, 0x41,             // 'ï'
+    0x30, 0x4A, 0x4D, 0x4D, 0x30, // 'ð'
+    0x7A, 0x0A, 0x0A, 0x72,       // 'ñ'
+    0x32, 0x4A, 0x48, 0x48, 0x30, // 'ò'
+    0x30, 0x48, 0x48, 0x4A, 0x32, // 'ó'
+    0x32, 0x49, 0x49, 0x49, 0x32, // 'ô'
+    0x32, 0x49, 0x49, 0x4A, 0x31, // 'õ'
+    0x3A, 0x44, 0x44, 0x44, 0x3A, // 'ö'
+    0x08, 0x08, 0x6B, 0x6B, 0x08, // '÷'
+    0xBC, 0x62, 0x5A, 0x46, 0x3D, // 'ø'
+    0x3A, 0x42, 0x40, 0x20, 0x78, // 'ù'
+    0x38, 0x40, 0x40, 0x22, 0x7A, // 'ú'
+    0x3A, 0x41, 0x41, 0x21, 0x7A, // 'û'
+    0x3A, 0x40, 0x40, 0x20, 0x7A, // 'ü'
+    0x4C, 0x90, 0x90, 0x90, 0x7C, // 'ý'
+    0xFC, 0x18, 0x24, 0x24, 0x18, // 'þ'
+    0x9D, 0xA0, 0xA0, 0x7D,       // 'ÿ'
+};
+
+static const uint16_t propOffset[225] = {
+      0,   2,   3,   6,  11,  16,  21,  26,  29,  32,  35,  40,  45,  48,  53,  55,
+     60,  65,  68,  73,  78,  83,  88,  93,  98, 103, 108, 109, 111, 115, 120, 124,
+    129, 134, 139, 144, 149, 154, 159, 164, 169, 174, 177, 182, 187, 192, 197, 202,
+    207, 212, 217, 222, 227, 232, 237, 242, 247, 252, 257, 262, 266, 271, 275, 280,
+    285, 288, 293, 298, 303, 308, 313, 317, 322, 327, 330, 334, 338, 341, 346, 351,
+    356, 361, 366, 371, 376, 381, 386, 391, 396, 401, 406, 411, 414, 415, 418, 423,
+    428, 433, 438, 443, 448, 453, 458, 463, 468, 473, 478, 483, 486, 490, 494, 499,
+    504, 508, 513, 518, 523, 528, 533, 538, 543, 547, 552, 557, 562, 567, 572, 577,
+    582, 584, 585, 590, 595, 600, 605, 606, 610, 613, 618, 623, 628, 633, 638, 643,
+    648, 653, 658, 662, 667, 670, 675, 680, 682, 685, 688, 693, 698, 703, 708, 713,
+    718, 723, 728, 733, 738, 743, 748, 753, 758, 763, 767, 772, 777, 780, 783, 786,
+    789, 794, 799, 804, 809, 814, 819, 824, 829, 834, 839, 844, 849, 854, 859, 864,
+    869, 874, 879, 884, 889, 894, 899, 904, 909, 914, 919, 924, 929, 933, 936, 940,
+    943, 948, 952, 957, 962, 967, 972, 977, 982, 987, 992, 997, 1002, 1007, 1012, 1017,
+    1021,
+};
+
+static const uint16_t propKernIdx[225] = {
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   1,   1,   3,  27,  27,  27,  29,  53,  55,  63,  63,  63,
+     63,  66,  66,  66,  66,  70,  70,  70,  70,  71,  75,  76,  76,  76,  76,  76,
+     76,  76,  84,  84,  84,  84,  84,  95,  95,  95, 103, 103, 103, 111, 111, 111,
+    111, 111, 111, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120,
+    120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120,
+    120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120,
+    120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120,
+    120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120,
+    120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120,
+    120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120,
+    120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120,
+    120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120,
+    120,
+};
+
+// Pares com kerning de -1, agrupados pelo caractere da esquerda
+static const KernPair propKern[120] = {
+    {'f',-1},  // 'C'
+    {'f',-1}, {'t',-1},  // 'E'
+    {'A',-1}, {'J',-1}, {'a',-1}, {'c',-1}, {'d',-1}, {'e',-1}, {'f',-1}, {'g',-1},
+    {'i',-1}, {'j',-1}, {'m',-1}, {'n',-1}, {'o',-1}, {'p',-1}, {'q',-1}, {'r',-1},
+    {'s',-1}, {'t',-1}, {'u',-1}, {'v',-1}, {'w',-1}, {'x',-1}, {'y',-1}, {'z',-1},  // 'F'
+    {'f',-1}, {'t',-1},  // 'I'
+    {'A',-1}, {'J',-1}, {'a',-1}, {'c',-1}, {'d',-1}, {'e',-1}, {'f',-1}, {'g',-1},
+    {'i',-1}, {'j',-1}, {'m',-1}, {'n',-1}, {'o',-1}, {'p',-1}, {'q',-1}, {'r',-1},
+    {'s',-1}, {'t',-1}, {'u',-1}, {'v',-1}, {'w',-1}, {'x',-1}, {'y',-1}, {'z',-1},  // 'J'
+    {'f',-1}, {'t',-1},  // 'K'
+    {'T',-1}, {'V',-1}, {'Y',-1}, {'f',-1}, {'g',-1}, {'q',-1}, {'t',-1}, {'v',-1},  // 'L'
+    {'J',-1}, {'a',-1}, {'j',-1},  // 'P'
+    {'J',-1}, {'a',-1}, {'f',-1}, {'j',-1},  // 'T'
+    {'f',-1},  // 'X'
+    {'J',-1}, {'a',-1}, {'f',-1}, {'j',-1},  // 'Y'
+    {'f',-1},  // 'Z'
+    {'T',-1}, {'V',-1}, {'Y',-1}, {'f',-1}, {'g',-1}, {'q',-1}, {'t',-1}, {'v',-1},  // 'a'
+    {'J',-1}, {'a',-1}, {'c',-1}, {'d',-1}, {'e',-1}, {'f',-1}, {'g',-1}, {'j',-1},
+    {'o',-1}, {'q',-1}, {'s',-1},  // 'f'
+    {'T',-1}, {'V',-1}, {'Y',-1}, {'f',-1}, {'g',-1}, {'q',-1}, {'t',-1}, {'v',-1},  // 'i'
+    {'T',-1}, {'V',-1}, {'Y',-1}, {'f',-1}, {'g',-1}, {'q',-1}, {'t',-1}, {'v',-1},  // 'l'
+    {'I',-1}, {'J',-1}, {'T',-1}, {'X',-1}, {'Y',-1}, {'Z',-1}, {'a',-1}, {'j',-1},
+    {'l',-1},  // 'r'
+};
+
+const PropFont font5x7Prop = {
+    propCols, propOffset, propKernIdx, propKern, ' ', 224, 1
+};
@@ -0,0 +1,93 @@
+/// fonts-rle.c - Fonte 20x28 em RLE (formato em fonts.h)
+///
+/// Gerado por sim/fontrle (make -C sim rle) a partir de font20x28 em
+/// fonts.c. Não editar à mão.
+#include <stdint.h>
+#include "fonts.h"
+
+const uint16_t font20x28Idx[FONT20X28_COUNT + 1] = {
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,   44,  122,  180,  232,  316,  374,
+     446,  478,  526,  558,  606,  638,  670,  702,  754,  806,  868,  938,
+    1022, 1054, 1086, 1118, 1150, 1206, 1238, 1322, 1322, 1322, 1322, 1322,
+    1382,
+};
+
+const uint8_t font20x28Rle[1382] = {
+    77, 3, 22, 6, 19, 8, 17, 8, 17, 10, 15, 8, 2, 3, 12, 8, 5, 3, 10, 6, 9, 3, 10, 6,
+    9, 3, 12, 8, 5, 3, 15, 8, 2, 3, 18, 10, 21, 8, 23, 8, 23, 6, 25, 3,  // 'a'
+    57, 23, 5, 23, 5, 23, 5, 3, 7, 3, 7, 3, 5, 3, 7, 3, 7, 3, 5, 3, 7, 3, 7, 3,
+    5, 3, 7, 3, 7, 3, 5, 3, 7, 3, 7, 3, 5, 3, 7, 3, 7, 3, 5, 3, 7, 3, 7, 3,
+    5, 3, 7, 3, 7, 3, 5, 3, 7, 3, 7, 3, 5, 3, 7, 3, 7, 3, 8, 7, 3, 7, 11, 7,
+    3, 7, 11, 7, 3, 7,  // 'b'
+    60, 17, 11, 17, 11, 17, 8, 3, 17, 3, 5, 3, 17, 3, 5, 3, 17, 3, 5, 3, 17, 3, 5, 3,
+    17, 3, 5, 3, 17, 3, 5, 3, 17, 3, 5, 3, 17, 3, 5, 3, 17, 3, 5, 3, 17, 3, 5, 3,
+    17, 3, 5, 3, 17, 3, 5, 3, 17, 3,  // 'c'
+    57, 23, 5, 23, 5, 23, 5, 3, 17, 3, 5, 3, 17, 3, 5, 3, 17, 3, 5, 3, 17, 3, 5, 3,
+    17, 3, 5, 3, 17, 3, 5, 3, 17, 3, 5, 3, 17, 3, 5, 3, 17, 3, 5, 3, 17, 3, 8, 17,
+    11, 17, 11, 17,  // 'd'
+    57, 23, 5, 23, 5, 23, 5, 3, 7, 3, 7, 3, 5, 3, 7, 3, 7, 3, 5, 3, 7, 3, 7, 3,
+    5, 3, 7, 3, 7, 3, 5, 3, 7, 3, 7, 3, 5, 3, 7, 3, 7, 3, 5, 3, 7, 3, 7, 3,
+    5, 3, 7, 3, 7, 3, 5, 3, 7, 3, 7, 3, 5, 3, 7, 3, 7, 3, 5, 3, 7, 3, 7, 3,
+    5, 3, 7, 3, 7, 3, 5, 3, 7, 3, 7, 3,  // 'e'
+    57, 23, 5, 23, 5, 23, 5, 3, 7, 3, 15, 3, 7, 3, 15, 3, 7, 3, 15, 3, 7, 3, 15, 3,
+    7, 3, 15, 3, 7, 3, 15, 3, 7, 3, 15, 3, 7, 3, 15, 3, 7, 3, 15, 3, 7, 3, 15, 3,
+    7, 3, 15, 3, 7, 3, 15, 3, 7, 3,  // 'f'
+    60, 17, 11, 17, 11, 17, 8, 3, 17, 3, 5, 3, 17, 3, 5, 3, 17, 3, 5, 3, 8, 3, 6, 3,
+    5, 3, 8, 3, 6, 3, 5, 3, 8, 3, 6, 3, 5, 3, 8, 3, 6, 3, 5, 3, 8, 3, 6, 3,
+    5, 3, 8, 3, 6, 3, 5, 3, 8, 3, 6, 3, 5, 3, 8, 9, 8, 3, 8, 9, 8, 3, 8, 9,  // 'g'
+    57, 23, 5, 23, 5, 23, 16, 3, 25, 3, 25, 3, 25, 3, 25, 3, 25, 3, 25, 3, 25, 3, 25, 3,
+    25, 3, 14, 23, 5, 23, 5, 23,  // 'h'
+    85, 2, 19, 2, 5, 2, 19, 2, 5, 2, 19, 2, 5, 2, 19, 2, 5, 2, 19, 2, 5, 23, 5, 23,
+    5, 23, 5, 23, 5, 2, 19, 2, 5, 2, 19, 2, 5, 2, 19, 2, 5, 2, 19, 2, 5, 2, 19, 2,  // 'i'
+    70, 7, 21, 7, 21, 7, 28, 3, 25, 3, 25, 3, 25, 3, 25, 3, 25, 3, 25, 3, 25, 3, 25, 3,
+    25, 3, 5, 20, 8, 20, 8, 20,  // 'j'
+    57, 23, 5, 23, 5, 23, 15, 3, 25, 3, 25, 3, 22, 3, 3, 3, 19, 3, 3, 3, 19, 3, 3, 3,
+    16, 3, 9, 3, 13, 3, 9, 3, 13, 3, 9, 3, 9, 4, 15, 4, 5, 4, 15, 4, 5, 4, 15, 4,  // 'k'
+    57, 23, 5, 23, 5, 23, 25, 3, 25, 3, 25, 3, 25, 3, 25, 3, 25, 3, 25, 3, 25, 3, 25, 3,
+    25, 3, 25, 3, 25, 3, 25, 3,  // 'l'
+    57, 23, 5, 23, 5, 23, 5, 4, 26, 4, 26, 4, 26, 4, 27, 3, 25, 3, 22, 4, 22, 4, 22, 4,
+    22, 4, 24, 23, 5, 23, 5, 23,  // 'm'
+    57, 23, 5, 23, 5, 23, 6, 4, 25, 5, 25, 5, 25, 5, 25, 5, 25, 5, 25, 5, 25, 5, 25, 5,
+    25, 4, 6, 23, 5, 23, 5, 23,  // 'n'
+    60, 17, 11, 17, 11, 17, 8, 3, 17, 3, 5, 3, 17, 3, 5, 3, 17, 3, 5, 3, 17, 3, 5, 3,
+    17, 3, 5, 3, 17, 3, 5, 3, 17, 3, 5, 3, 17, 3, 5, 3, 17, 3, 5, 3, 17, 3, 8, 17,
+    11, 17, 11, 17,  // 'o'
+    57, 23, 5, 23, 5, 23, 5, 3, 7, 3, 15, 3, 7, 3, 15, 3, 7, 3, 15, 3, 7, 3, 15, 3,
+    7, 3, 15, 3, 7, 3, 15, 3, 7, 3, 15, 3, 7, 3, 15, 3, 7, 3, 15, 3, 7, 3, 18, 7,
+    21, 7, 21, 7,  // 'p'
+    60, 17, 11, 17, 11, 17, 8, 3, 14, 6, 5, 3, 14, 6, 5, 3, 14, 6, 5, 3, 11, 3, 3, 3,
+    5, 3, 11, 3, 3, 3, 5, 3, 11, 3, 3, 3, 5, 3, 14, 6, 5, 3, 14, 6, 5, 3, 14, 3,
+    8, 3, 17, 6, 5, 16, 1, 6, 5, 16, 1, 6, 5, 16,  // 'q'
+    57, 23, 5, 23, 5, 23, 5, 3, 7, 3, 15, 3, 7, 4, 14, 3, 7, 4, 14, 3, 7, 4, 14, 3,
+    7, 3, 1, 3, 11, 3, 7, 3, 1, 3, 11, 3, 7, 3, 1, 3, 11, 3, 7, 3, 4, 3, 8, 3,
+    7, 3, 4, 3, 8, 3, 7, 3, 4, 3, 11, 7, 10, 3, 8, 7, 10, 3, 8, 7, 10, 3,  // 'r'
+    60, 10, 6, 4, 8, 10, 6, 4, 8, 10, 6, 4, 5, 3, 7, 3, 7, 3, 5, 3, 7, 3, 7, 3,
+    5, 3, 7, 3, 7, 3, 5, 3, 7, 3, 7, 3, 5, 3, 7, 3, 7, 3, 5, 3, 7, 3, 7, 3,
+    5, 3, 7, 3, 7, 3, 5, 3, 7, 3, 7, 3, 5, 3, 7, 3, 7, 3, 5, 3, 7, 3, 7, 3,
+    5, 4, 6, 10, 8, 4, 6, 10, 8, 4, 6, 10,  // 's'
+    57, 3, 25, 3, 25, 3, 25, 3, 25, 3, 25, 3, 25, 23, 5, 23, 5, 23, 5, 23, 5, 3, 25, 3,
+    25, 3, 25, 3, 25, 3, 25, 3,  // 't'
+    57, 23, 5, 23, 5, 23, 25, 3, 25, 3, 25, 3, 25, 3, 25, 3, 25, 3, 25, 3, 25, 3, 25, 3,
+    25, 3, 5, 23, 5, 23, 5, 23,  // 'u'
+    57, 6, 22, 9, 23, 9, 22, 9, 23, 8, 23, 7, 24, 6, 26, 2, 26, 2, 22, 5, 20, 7, 18, 8,
+    16, 9, 16, 9, 15, 9, 19, 6,  // 'v'
+    57, 23, 5, 23, 5, 23, 24, 4, 22, 4, 22, 4, 22, 4, 22, 3, 25, 3, 27, 4, 26, 4, 26, 4,
+    26, 4, 5, 23, 5, 23, 5, 23,  // 'w'
+    57, 7, 9, 7, 5, 7, 9, 7, 5, 7, 9, 7, 12, 3, 3, 3, 19, 3, 3, 3, 19, 3, 3, 3,
+    22, 3, 25, 3, 25, 3, 25, 3, 22, 3, 3, 3, 19, 3, 3, 3, 19, 3, 3, 3, 12, 7, 9, 7,
+    5, 7, 9, 7, 5, 7, 9, 7,  // 'x'
+    57, 6, 22, 6, 22, 6, 28, 4, 24, 4, 24, 4, 28, 13, 15, 13, 15, 13, 15, 13, 11, 4, 24, 4,
+    24, 4, 18, 6, 22, 6, 22, 6,  // 'y'
+    57, 3, 13, 7, 5, 3, 12, 8, 5, 3, 11, 9, 5, 3, 10, 5, 2, 3, 5, 3, 9, 5, 3, 3,
+    5, 3, 8, 5, 4, 3, 5, 3, 7, 5, 5, 3, 5, 3, 6, 5, 6, 3, 5, 3, 5, 5, 7, 3,
+    5, 3, 4, 5, 8, 3, 5, 3, 3, 5, 9, 3, 5, 3, 2, 5, 10, 3, 5, 3, 1, 5, 11, 3,
+    5, 8, 12, 3, 5, 7, 13, 3, 5, 6, 14, 3,  // 'z'
+    101, 4, 24, 4, 24, 4, 14, 3, 4, 3, 4, 3, 11, 3, 4, 3, 4, 3, 11, 3, 4, 3, 4, 3,
+    11, 3, 4, 3, 4, 3, 11, 3, 4, 3, 4, 3, 11, 3, 4, 3, 4, 3, 11, 3, 4, 3, 4, 3,
+    11, 3, 4, 3, 4, 3, 14, 11, 17, 11, 17, 11,  // '?'
+};
@@ -0,0 +1,1567 @@
+/// fonts-subset.c - Subconjunto das fontes com os glifos usados pelas telas
+///
+/// Gerado por sim/fontsubset (make -C sim subset) a partir de:
+///   ../main.c
+/// Não editar à mão. Só é compilado com FONT_SUBSET = 1, que tira as
+/// tabelas completas do build.
+#include <stdint.h>
+#include "fonts.h"
+#include "_fonts/fonts.h"
+
+#if FONT_SUBSET
+
+// 49 glifos: " 0123456789:ACEFILMNOPRSTVabcdegiklmnoprstuvxyãçé"
+
+const uint8_t font5x7Map[224] = {
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11,  0,  0,  0,  0,  0,
+     0, 12,  0, 13,  0, 14, 15,  0,  0, 16,  0,  0, 17, 18, 19, 20,
+    21,  0, 22, 23, 24,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0, 26, 27, 28, 29, 30,  0, 31,  0, 32,  0, 33, 34, 35, 36, 37,
+    38,  0, 39, 40, 41, 42, 43,  0, 44, 45,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0, 46,  0,  0,  0, 47,  0, 48,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+};
+
+const uint8_t font5x7[][5] = {
+    {0x00,0x00,0x00,0x00,0x00},  // ' '
+    {0x3E,0x51,0x49,0x45,0x3E},  // '0'
+    {0x00,0x42,0x7F,0x40,0x00},  // '1'
+    {0x72,0x49,0x49,0x49,0x46},  // '2'
+    {0x21,0x41,0x49,0x4D,0x33},  // '3'
+    {0x18,0x14,0x12,0x7F,0x10},  // '4'
+    {0x27,0x45,0x45,0x45,0x39},  // '5'
+    {0x3C,0x4A,0x49,0x49,0x31},  // '6'
+    {0x41,0x21,0x11,0x09,0x07},  // '7'
+    {0x36,0x49,0x49,0x49,0x36},  // '8'
+    {0x46,0x49,0x49,0x29,0x1E},  // '9'
+    {0x00,0x00,0x14,0x00,0x00},  // ':'
+    {0x7C,0x12,0x11,0x12,0x7C},  // 'A'
+    {0x3E,0x41,0x41,0x41,0x22},  // 'C'
+    {0x7F,0x49,0x49,0x49,0x41},  // 'E'
+    {0x7F,0x09,0x09,0x09,0x01},  // 'F'
+    {0x00,0x41,0x7F,0x41,0x00},  // 'I'
+    {0x7F,0x40,0x40,0x40,0x40},  // 'L'
+    {0x7F,0x02,0x1C,0x02,0x7F},  // 'M'
+    {0x7F,0x04,0x08,0x10,0x7F},  // 'N'
+    {0x3E,0x41,0x41,0x41,0x3E},  // 'O'
+    {0x7F,0x09,0x09,0x09,0x06},  // 'P'
+    {0x7F,0x09,0x19,0x29,0x46},  // 'R'
+    {0x26,0x49,0x49,0x49,0x32},  // 'S'
+    {0x03,0x01,0x7F,0x01,0x03},  // 'T'
+    {0x1F,0x20,0x40,0x20,0x1F},  // 'V'
+    {0x20,0x54,0x54,0x78,0x40},  // 'a'
+    {0x7F,0x28,0x44,0x44,0x38},  // 'b'
+    {0x38,0x44,0x44,0x44,0x28},  // 'c'
+    {0x38,0x44,0x44,0x28,0x7F},  // 'd'
+    {0x38,0x54,0x54,0x54,0x18},  // 'e'
+    {0x18,0xA4,0xA4,0x9C,0x78},  // 'g'
+    {0x00,0x44,0x7D,0x40,0x00},  // 'i'
+    {0x7F,0x10,0x28,0x44,0x00},  // 'k'
+    {0x00,0x41,0x7F,0x40,0x00},  // 'l'
+    {0x7C,0x04,0x78,0x04,0x78},  // 'm'
+    {0x7C,0x08,0x04,0x04,0x78},  // 'n'
+    {0x38,0x44,0x44,0x44,0x38},  // 'o'
+    {0xFC,0x18,0x24,0x24,0x18},  // 'p'
+    {0x7C,0x08,0x04,0x04,0x08},  // 'r'
+    {0x48,0x54,0x54,0x54,0x24},  // 's'
+    {0x04,0x04,0x3F,0x44,0x24},  // 't'
+    {0x3C,0x40,0x40,0x20,0x7C},  // 'u'
+    {0x1C,0x20,0x40,0x20,0x1C},  // 'v'
+    {0x44,0x28,0x10,0x28,0x44},  // 'x'
+    {0x4C,0x90,0x90,0x90,0x7C},  // 'y'
+    {0x22,0x55,0x55,0x7A,0x41},  // 'ã'
+    {0x0C,0x1E,0x52,0x72,0x12},  // 'ç'
+    {0x38,0x54,0x54,0x55,0x59},  // 'é'
+};
+
+static const uint8_t Font8_Map[95] = {
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11,  0,  0,  0,  0,  0,
+     0, 12,  0, 13,  0, 14, 15,  0,  0, 16,  0,  0, 17, 18, 19, 20,
+    21,  0, 22, 23, 24,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0, 26, 27, 28, 29, 30,  0, 31,  0, 32,  0, 33, 34, 35, 36, 37,
+    38,  0, 39, 40, 41, 42, 43,  0, 44, 45,  0,  0,  0,  0,  0,
+};
+
+static const uint8_t Font8_Table[] = {
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // ' '
+    0x20,0x50,0x50,0x50,0x50,0x20,0x00,0x00,  // '0'
+    0x60,0x20,0x20,0x20,0x20,0xF8,0x00,0x00,  // '1'
+    0x20,0x50,0x20,0x20,0x40,0x70,0x00,0x00,  // '2'
+    0x20,0x50,0x10,0x20,0x10,0x60,0x00,0x00,  // '3'
+    0x10,0x30,0x50,0x78,0x10,0x38,0x00,0x00,  // '4'
+    0x70,0x40,0x60,0x10,0x50,0x20,0x00,0x00,  // '5'
+    0x30,0x40,0x60,0x50,0x50,0x60,0x00,0x00,  // '6'
+    0x70,0x50,0x10,0x20,0x20,0x20,0x00,0x00,  // '7'
+    0x20,0x50,0x20,0x50,0x50,0x20,0x00,0x00,  // '8'
+    0x30,0x50,0x50,0x30,0x10,0x60,0x00,0x00,  // '9'
+    0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,  // ':'
+    0x60,0x20,0x50,0x70,0x88,0xD8,0x00,0x00,  // 'A'
+    0x70,0x50,0x40,0x40,0x40,0x30,0x00,0x00,  // 'C'
+    0xF8,0x48,0x60,0x40,0x48,0xF8,0x00,0x00,  // 'E'
+    0xF8,0x48,0x60,0x40,0x40,0xE0,0x00,0x00,  // 'F'
+    0x70,0x20,0x20,0x20,0x20,0x70,0x00,0x00,  // 'I'
+    0xE0,0x40,0x40,0x40,0x48,0xF8,0x00,0x00,  // 'L'
+    0xD8,0xD8,0xD8,0xA8,0x88,0xD8,0x00,0x00,  // 'M'
+    0xD8,0x68,0x68,0x58,0x58,0xE8,0x00,0x00,  // 'N'
+    0x30,0x48,0x48,0x48,0x48,0x30,0x00,0x00,  // 'O'
+    0xF0,0x48,0x48,0x70,0x40,0xE0,0x00,0x00,  // 'P'
+    0xF0,0x48,0x48,0x70,0x48,0xE8,0x00,0x00,  // 'R'
+    0x70,0x50,0x20,0x10,0x50,0x70,0x00,0x00,  // 'S'
+    0xF8,0xA8,0x20,0x20,0x20,0x70,0x00,0x00,  // 'T'
+    0xD8,0x88,0x48,0x50,0x50,0x30,0x00,0x00,  // 'V'
+    0x00,0x00,0x30,0x10,0x70,0x78,0x00,0x00,  // 'a'
+    0xC0,0x40,0x70,0x48,0x48,0xF0,0x00,0x00,  // 'b'
+    0x00,0x00,0x70,0x40,0x40,0x70,0x00,0x00,  // 'c'
+    0x18,0x08,0x38,0x48,0x48,0x38,0x00,0x00,  // 'd'
+    0x00,0x00,0x70,0x70,0x40,0x30,0x00,0x00,  // 'e'
+    0x00,0x00,0x38,0x48,0x48,0x38,0x08,0x30,  // 'g'
+    0x20,0x00,0x60,0x20,0x20,0x70,0x00,0x00,  // 'i'
+    0xC0,0x40,0x58,0x70,0x50,0xD8,0x00,0x00,  // 'k'
+    0x60,0x20,0x20,0x20,0x20,0x70,0x00,0x00,  // 'l'
+    0x00,0x00,0xD0,0xA8,0xA8,0xA8,0x00,0x00,  // 'm'
+    0x00,0x00,0xF0,0x48,0x48,0xC8,0x00,0x00,  // 'n'
+    0x00,0x00,0x30,0x48,0x48,0x30,0x00,0x00,  // 'o'
+    0x00,0x00,0xF0,0x48,0x48,0x70,0x40,0xE0,  // 'p'
+    0x00,0x00,0x78,0x20,0x20,0x70,0x00,0x00,  // 'r'
+    0x00,0x00,0x30,0x20,0x10,0x60,0x00,0x00,  // 's'
+    0x00,0x40,0xF0,0x40,0x48,0x30,0x00,0x00,  // 't'
+    0x00,0x00,0xD8,0x48,0x48,0x38,0x00,0x00,  // 'u'
+    0x00,0x00,0xC8,0x48,0x30,0x30,0x00,0x00,  // 'v'
+    0x00,0x00,0x48,0x30,0x30,0x48,0x00,0x00,  // 'x'
+    0x00,0x00,0xD8,0x50,0x50,0x20,0x20,0x60,  // 'y'
+};
+
+sFONT Font8 = { Font8_Table, 5, 8, Font8_Map };
+
+static const uint8_t Font12_Map[95] = {
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11,  0,  0,  0,  0,  0,
+     0, 12,  0, 13,  0, 14, 15,  0,  0, 16,  0,  0, 17, 18, 19, 20,
+    21,  0, 22, 23, 24,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0, 26, 27, 28, 29, 30,  0, 31,  0, 32,  0, 33, 34, 35, 36, 37,
+    38,  0, 39, 40, 41, 42, 43,  0, 44, 45,  0,  0,  0,  0,  0,
+};
+
+static const uint8_t Font12_Table[] = {
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // ' '
+    0x00,0x38,0x44,0x44,0x44,0x44,0x44,0x44,0x38,0x00,0x00,0x00,  // '0'
+    0x00,0x30,0x10,0x10,0x10,0x10,0x10,0x10,0x7C,0x00,0x00,0x00,  // '1'
+    0x00,0x38,0x44,0x04,0x08,0x10,0x20,0x44,0x7C,0x00,0x00,0x00,  // '2'
+    0x00,0x38,0x44,0x04,0x18,0x04,0x04,0x44,0x38,0x00,0x00,0x00,  // '3'
+    0x00,0x0C,0x14,0x14,0x24,0x44,0x7E,0x04,0x0E,0x00,0x00,0x00,  // '4'
+    0x00,0x3C,0x20,0x20,0x38,0x04,0x04,0x44,0x38,0x00,0x00,0x00,  // '5'
+    0x00,0x1C,0x20,0x40,0x78,0x44,0x44,0x44,0x38,0x00,0x00,0x00,  // '6'
+    0x00,0x7C,0x44,0x04,0x08,0x08,0x08,0x10,0x10,0x00,0x00,0x00,  // '7'
+    0x00,0x38,0x44,0x44,0x38,0x44,0x44,0x44,0x38,0x00,0x00,0x00,  // '8'
+    0x00,0x38,0x44,0x44,0x44,0x3C,0x04,0x08,0x70,0x00,0x00,0x00,  // '9'
+    0x00,0x00,0x00,0x30,0x30,0x00,0x00,0x30,0x30,0x00,0x00,0x00,  // ':'
+    0x00,0x30,0x10,0x28,0x28,0x28,0x7C,0x44,0xEE,0x00,0x00,0x00,  // 'A'
+    0x00,0x3C,0x44,0x40,0x40,0x40,0x40,0x44,0x38,0x00,0x00,0x00,  // 'C'
+    0x00,0xFC,0x44,0x50,0x70,0x50,0x40,0x44,0xFC,0x00,0x00,0x00,  // 'E'
+    0x00,0x7E,0x22,0x28,0x38,0x28,0x20,0x20,0x70,0x00,0x00,0x00,  // 'F'
+    0x00,0x7C,0x10,0x10,0x10,0x10,0x10,0x10,0x7C,0x00,0x00,0x00,  // 'I'
+    0x00,0x70,0x20,0x20,0x20,0x20,0x24,0x24,0x7C,0x00,0x00,0x00,  // 'L'
+    0x00,0xEE,0x6C,0x6C,0x54,0x54,0x44,0x44,0xEE,0x00,0x00,0x00,  // 'M'
+    0x00,0xEE,0x64,0x64,0x54,0x54,0x54,0x4C,0xEC,0x00,0x00,0x00,  // 'N'
+    0x00,0x38,0x44,0x44,0x44,0x44,0x44,0x44,0x38,0x00,0x00,0x00,  // 'O'
+    0x00,0x78,0x24,0x24,0x24,0x38,0x20,0x20,0x70,0x00,0x00,0x00,  // 'P'
+    0x00,0xF8,0x44,0x44,0x44,0x78,0x48,0x44,0xE2,0x00,0x00,0x00,  // 'R'
+    0x00,0x34,0x4C,0x40,0x38,0x04,0x04,0x64,0x58,0x00,0x00,0x00,  // 'S'
+    0x00,0xFE,0x92,0x10,0x10,0x10,0x10,0x10,0x38,0x00,0x00,0x00,  // 'T'
+    0x00,0xEE,0x44,0x44,0x28,0x28,0x28,0x10,0x10,0x00,0x00,0x00,  // 'V'
+    0x00,0x00,0x00,0x38,0x44,0x3C,0x44,0x44,0x3E,0x00,0x00,0x00,  // 'a'
+    0x00,0xC0,0x40,0x58,0x64,0x44,0x44,0x44,0xF8,0x00,0x00,0x00,  // 'b'
+    0x00,0x00,0x00,0x3C,0x44,0x40,0x40,0x44,0x38,0x00,0x00,0x00,  // 'c'
+    0x00,0x0C,0x04,0x34,0x4C,0x44,0x44,0x44,0x3E,0x00,0x00,0x00,  // 'd'
+    0x00,0x00,0x00,0x38,0x44,0x7C,0x40,0x40,0x3C,0x00,0x00,0x00,  // 'e'
+    0x00,0x00,0x00,0x36,0x4C,0x44,0x44,0x44,0x3C,0x04,0x38,0x00,  // 'g'
+    0x00,0x10,0x00,0x70,0x10,0x10,0x10,0x10,0x7C,0x00,0x00,0x00,  // 'i'
+    0x00,0xC0,0x40,0x5C,0x48,0x70,0x50,0x48,0xDC,0x00,0x00,0x00,  // 'k'
+    0x00,0x30,0x10,0x10,0x10,0x10,0x10,0x10,0x7C,0x00,0x00,0x00,  // 'l'
+    0x00,0x00,0x00,0xE8,0x54,0x54,0x54,0x54,0xFE,0x00,0x00,0x00,  // 'm'
+    0x00,0x00,0x00,0xD8,0x64,0x44,0x44,0x44,0xEE,0x00,0x00,0x00,  // 'n'
+    0x00,0x00,0x00,0x38,0x44,0x44,0x44,0x44,0x38,0x00,0x00,0x00,  // 'o'
+    0x00,0x00,0x00,0xD8,0x64,0x44,0x44,0x44,0x78,0x40,0xE0,0x00,  // 'p'
+    0x00,0x00,0x00,0x6C,0x30,0x20,0x20,0x20,0x7C,0x00,0x00,0x00,  // 'r'
+    0x00,0x00,0x00,0x3C,0x44,0x38,0x04,0x44,0x78,0x00,0x00,0x00,  // 's'
+    0x00,0x00,0x20,0x7C,0x20,0x20,0x20,0x22,0x1C,0x00,0x00,0x00,  // 't'
+    0x00,0x00,0x00,0xCC,0x44,0x44,0x44,0x4C,0x36,0x00,0x00,0x00,  // 'u'
+    0x00,0x00,0x00,0xEE,0x44,0x44,0x28,0x28,0x10,0x00,0x00,0x00,  // 'v'
+    0x00,0x00,0x00,0xCC,0x48,0x30,0x30,0x48,0xCC,0x00,0x00,0x00,  // 'x'
+    0x00,0x00,0x00,0xEE,0x44,0x24,0x28,0x18,0x10,0x10,0x78,0x00,  // 'y'
+};
+
+sFONT Font12 = { Font12_Table, 7, 12, Font12_Map };
+
+static const uint8_t Font16_Map[95] = {
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11,  0,  0,  0,  0,  0,
+     0, 12,  0, 13,  0, 14, 15,  0,  0, 16,  0,  0, 17, 18, 19, 20,
+    21,  0, 22, 23, 24,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0, 26, 27, 28, 29, 30,  0, 31,  0, 32,  0, 33, 34, 35, 36, 37,
+    38,  0, 39, 40, 41, 42, 43,  0, 44, 45,  0,  0,  0,  0,  0,
+};
+
+static const uint8_t Font16_Table[] = {
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // ' '
+    0x00,0x00,0x0E,0x00,0x1B,0x00,0x31,0x80,0x31,0x80,0x31,0x80,0x31,0x80,0x31,0x80,
+    0x31,0x80,0x1B,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '0'
+    0x00,0x00,0x06,0x00,0x3E,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,
+    0x06,0x00,0x06,0x00,0x3F,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '1'
+    0x00,0x00,0x0F,0x00,0x19,0x80,0x31,0x80,0x31,0x80,0x03,0x00,0x06,0x00,0x0C,0x00,
+    0x18,0x00,0x30,0x00,0x3F,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '2'
+    0x00,0x00,0x3F,0x00,0x61,0x80,0x01,0x80,0x03,0x00,0x1F,0x00,0x03,0x80,0x01,0x80,
+    0x01,0x80,0x61,0x80,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '3'
+    0x00,0x00,0x07,0x00,0x07,0x00,0x0F,0x00,0x0B,0x00,0x1B,0x00,0x13,0x00,0x33,0x00,
+    0x3F,0x80,0x03,0x00,0x0F,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '4'
+    0x00,0x00,0x1F,0x80,0x18,0x00,0x18,0x00,0x18,0x00,0x1F,0x00,0x11,0x80,0x01,0x80,
+    0x01,0x80,0x21,0x80,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '5'
+    0x00,0x00,0x07,0x80,0x1C,0x00,0x18,0x00,0x30,0x00,0x37,0x00,0x39,0x80,0x31,0x80,
+    0x31,0x80,0x19,0x80,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '6'
+    0x00,0x00,0x7F,0x00,0x43,0x00,0x03,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,
+    0x0C,0x00,0x0C,0x00,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '7'
+    0x00,0x00,0x1F,0x00,0x31,0x80,0x31,0x80,0x31,0x80,0x1F,0x00,0x31,0x80,0x31,0x80,
+    0x31,0x80,0x31,0x80,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '8'
+    0x00,0x00,0x1E,0x00,0x33,0x00,0x31,0x80,0x31,0x80,0x33,0x80,0x1D,0x80,0x01,0x80,
+    0x03,0x00,0x07,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '9'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x0C,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x0C,0x00,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // ':'
+    0x00,0x00,0x00,0x00,0x3F,0x00,0x0F,0x00,0x09,0x00,0x19,0x80,0x19,0x80,0x1F,0x80,
+    0x30,0xC0,0x30,0xC0,0x79,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'A'
+    0x00,0x00,0x00,0x00,0x1F,0x40,0x30,0xC0,0x60,0x40,0x60,0x00,0x60,0x00,0x60,0x00,
+    0x60,0x40,0x30,0x80,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'C'
+    0x00,0x00,0x00,0x00,0x7F,0x80,0x30,0x80,0x30,0x80,0x32,0x00,0x3E,0x00,0x32,0x00,
+    0x30,0x80,0x30,0x80,0x7F,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'E'
+    0x00,0x00,0x00,0x00,0x7F,0xC0,0x30,0x40,0x30,0x40,0x32,0x00,0x3E,0x00,0x32,0x00,
+    0x30,0x00,0x30,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'F'
+    0x00,0x00,0x00,0x00,0x3F,0xC0,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,
+    0x06,0x00,0x06,0x00,0x3F,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'I'
+    0x00,0x00,0x00,0x00,0x7E,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x40,
+    0x18,0x40,0x18,0x40,0x7F,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'L'
+    0x00,0x00,0x00,0x00,0xE0,0xE0,0x60,0xC0,0x71,0xC0,0x7B,0xC0,0x6A,0xC0,0x6E,0xC0,
+    0x64,0xC0,0x60,0xC0,0xFB,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'M'
+    0x00,0x00,0x00,0x00,0x73,0xC0,0x31,0x80,0x39,0x80,0x3D,0x80,0x35,0x80,0x37,0x80,
+    0x33,0x80,0x31,0x80,0x79,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'N'
+    0x00,0x00,0x00,0x00,0x1F,0x00,0x31,0x80,0x60,0xC0,0x60,0xC0,0x60,0xC0,0x60,0xC0,
+    0x60,0xC0,0x31,0x80,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'O'
+    0x00,0x00,0x00,0x00,0x7F,0x00,0x31,0x80,0x31,0x80,0x31,0x80,0x31,0x80,0x3F,0x00,
+    0x30,0x00,0x30,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'P'
+    0x00,0x00,0x00,0x00,0x7F,0x00,0x31,0x80,0x31,0x80,0x31,0x80,0x3E,0x00,0x33,0x00,
+    0x31,0x80,0x31,0x80,0x7C,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'R'
+    0x00,0x00,0x00,0x00,0x1F,0x80,0x31,0x80,0x31,0x80,0x38,0x00,0x1F,0x00,0x03,0x80,
+    0x31,0x80,0x31,0x80,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'S'
+    0x00,0x00,0x00,0x00,0x7F,0x80,0x4C,0x80,0x4C,0x80,0x4C,0x80,0x0C,0x00,0x0C,0x00,
+    0x0C,0x00,0x0C,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'T'
+    0x00,0x00,0x00,0x00,0x7B,0xC0,0x31,0x80,0x31,0x80,0x1B,0x00,0x1B,0x00,0x1B,0x00,
+    0x0A,0x00,0x0E,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'V'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x01,0x80,0x01,0x80,0x1F,0x80,
+    0x31,0x80,0x33,0x80,0x1D,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'a'
+    0x00,0x00,0x70,0x00,0x30,0x00,0x30,0x00,0x37,0x00,0x39,0x80,0x30,0xC0,0x30,0xC0,
+    0x30,0xC0,0x39,0x80,0x77,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'b'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0x80,0x31,0x80,0x60,0x80,0x60,0x00,
+    0x60,0x80,0x31,0x80,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'c'
+    0x00,0x00,0x03,0x80,0x01,0x80,0x01,0x80,0x1D,0x80,0x33,0x80,0x61,0x80,0x61,0x80,
+    0x61,0x80,0x33,0x80,0x1D,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'd'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x31,0x80,0x60,0xC0,0x7F,0xC0,
+    0x60,0x00,0x30,0xC0,0x1F,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'e'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1D,0xC0,0x33,0x80,0x61,0x80,0x61,0x80,
+    0x61,0x80,0x33,0x80,0x1D,0x80,0x01,0x80,0x01,0x80,0x1F,0x00,0x00,0x00,0x00,0x00,  // 'g'
+    0x00,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0x1E,0x00,0x06,0x00,0x06,0x00,0x06,0x00,
+    0x06,0x00,0x06,0x00,0x3F,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'i'
+    0x00,0x00,0x70,0x00,0x30,0x00,0x30,0x00,0x37,0x80,0x36,0x00,0x3C,0x00,0x3C,0x00,
+    0x36,0x00,0x33,0x00,0x77,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'k'
+    0x00,0x00,0x1E,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,
+    0x06,0x00,0x06,0x00,0x3F,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'l'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x80,0x36,0xC0,0x36,0xC0,0x36,0xC0,
+    0x36,0xC0,0x36,0xC0,0x76,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'm'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x77,0x00,0x39,0x80,0x31,0x80,0x31,0x80,
+    0x31,0x80,0x31,0x80,0x7B,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'n'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x31,0x80,0x60,0xC0,0x60,0xC0,
+    0x60,0xC0,0x31,0x80,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'o'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x77,0x00,0x39,0x80,0x30,0xC0,0x30,0xC0,
+    0x30,0xC0,0x39,0x80,0x37,0x00,0x30,0x00,0x30,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,  // 'p'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x80,0x1C,0xC0,0x18,0x00,0x18,0x00,
+    0x18,0x00,0x18,0x00,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'r'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x80,0x31,0x80,0x3C,0x00,0x1F,0x00,
+    0x03,0x80,0x31,0x80,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 's'
+    0x00,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x7F,0x00,0x18,0x00,0x18,0x00,0x18,0x00,
+    0x18,0x00,0x18,0x80,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 't'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,0x80,0x31,0x80,0x31,0x80,0x31,0x80,
+    0x31,0x80,0x33,0x80,0x1D,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'u'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0xC0,0x31,0x80,0x31,0x80,0x1B,0x00,
+    0x1B,0x00,0x0E,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'v'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0xC0,0x1B,0x00,0x0E,0x00,0x0E,0x00,
+    0x0E,0x00,0x1B,0x00,0x7B,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'x'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x79,0xE0,0x30,0xC0,0x19,0x80,0x19,0x80,
+    0x0B,0x00,0x0F,0x00,0x06,0x00,0x06,0x00,0x0C,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,  // 'y'
+};
+
+sFONT Font16 = { Font16_Table, 11, 16, Font16_Map };
+
+static const uint8_t Font20_Map[95] = {
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11,  0,  0,  0,  0,  0,
+     0, 12,  0, 13,  0, 14, 15,  0,  0, 16,  0,  0, 17, 18, 19, 20,
+    21,  0, 22, 23, 24,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0, 26, 27, 28, 29, 30,  0, 31,  0, 32,  0, 33, 34, 35, 36, 37,
+    38,  0, 39, 40, 41, 42, 43,  0, 44, 45,  0,  0,  0,  0,  0,
+};
+
+static const uint8_t Font20_Table[] = {
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // ' '
+    0x00,0x00,0x0F,0x80,0x1F,0xC0,0x18,0xC0,0x30,0x60,0x30,0x60,0x30,0x60,0x30,0x60,
+    0x30,0x60,0x30,0x60,0x30,0x60,0x18,0xC0,0x1F,0xC0,0x0F,0x80,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '0'
+    0x00,0x00,0x03,0x00,0x1F,0x00,0x1F,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+    0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x1F,0xE0,0x1F,0xE0,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '1'
+    0x00,0x00,0x0F,0x80,0x1F,0xC0,0x38,0xE0,0x30,0x60,0x00,0x60,0x00,0xC0,0x01,0x80,
+    0x03,0x00,0x06,0x00,0x0C,0x00,0x18,0x00,0x3F,0xE0,0x3F,0xE0,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '2'
+    0x00,0x00,0x0F,0x80,0x3F,0xC0,0x30,0xE0,0x00,0x60,0x00,0xE0,0x07,0xC0,0x07,0xC0,
+    0x00,0xE0,0x00,0x60,0x00,0x60,0x60,0xE0,0x7F,0xC0,0x3F,0x80,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '3'
+    0x00,0x00,0x01,0xC0,0x03,0xC0,0x03,0xC0,0x06,0xC0,0x0C,0xC0,0x0C,0xC0,0x18,0xC0,
+    0x30,0xC0,0x3F,0xE0,0x3F,0xE0,0x00,0xC0,0x03,0xE0,0x03,0xE0,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '4'
+    0x00,0x00,0x1F,0xC0,0x1F,0xC0,0x18,0x00,0x18,0x00,0x1F,0x80,0x1F,0xC0,0x18,0xE0,
+    0x00,0x60,0x00,0x60,0x00,0x60,0x30,0xE0,0x3F,0xC0,0x1F,0x80,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '5'
+    0x00,0x00,0x03,0xE0,0x0F,0xE0,0x1E,0x00,0x18,0x00,0x38,0x00,0x37,0x80,0x3F,0xC0,
+    0x38,0xE0,0x30,0x60,0x30,0x60,0x18,0xE0,0x1F,0xC0,0x07,0x80,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '6'
+    0x00,0x00,0x3F,0xE0,0x3F,0xE0,0x30,0x60,0x00,0x60,0x00,0xC0,0x00,0xC0,0x00,0xC0,
+    0x01,0x80,0x01,0x80,0x01,0x80,0x03,0x00,0x03,0x00,0x03,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '7'
+    0x00,0x00,0x0F,0x80,0x1F,0xC0,0x38,0xE0,0x30,0x60,0x38,0xE0,0x1F,0xC0,0x1F,0xC0,
+    0x38,0xE0,0x30,0x60,0x30,0x60,0x38,0xE0,0x1F,0xC0,0x0F,0x80,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '8'
+    0x00,0x00,0x0F,0x00,0x1F,0xC0,0x38,0xC0,0x30,0x60,0x30,0x60,0x38,0xE0,0x1F,0xE0,
+    0x0F,0x60,0x00,0xE0,0x00,0xC0,0x03,0xC0,0x3F,0x80,0x3E,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '9'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x80,0x03,0x80,0x03,0x80,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x80,0x03,0x80,0x03,0x80,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // ':'
+    0x00,0x00,0x00,0x00,0x1F,0x80,0x1F,0x80,0x03,0x80,0x06,0xC0,0x06,0xC0,0x0C,0xC0,
+    0x0C,0x60,0x1F,0xE0,0x1F,0xE0,0x30,0x30,0x78,0x78,0x78,0x78,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'A'
+    0x00,0x00,0x00,0x00,0x07,0xB0,0x0F,0xF0,0x1C,0x70,0x38,0x30,0x30,0x00,0x30,0x00,
+    0x30,0x00,0x30,0x00,0x38,0x30,0x1C,0x70,0x0F,0xE0,0x07,0xC0,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'C'
+    0x00,0x00,0x00,0x00,0x3F,0xF0,0x3F,0xF0,0x18,0x30,0x18,0x30,0x19,0x80,0x1F,0x80,
+    0x1F,0x80,0x19,0x80,0x18,0x30,0x18,0x30,0x3F,0xF0,0x3F,0xF0,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'E'
+    0x00,0x00,0x00,0x00,0x3F,0xF0,0x3F,0xF0,0x18,0x30,0x18,0x30,0x19,0x80,0x1F,0x80,
+    0x1F,0x80,0x19,0x80,0x18,0x00,0x18,0x00,0x3F,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'F'
+    0x00,0x00,0x00,0x00,0x1F,0xE0,0x1F,0xE0,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+    0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x1F,0xE0,0x1F,0xE0,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'I'
+    0x00,0x00,0x00,0x00,0x3F,0x00,0x3F,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,
+    0x0C,0x00,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x3F,0xF0,0x3F,0xF0,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'L'
+    0x00,0x00,0x00,0x00,0x78,0x78,0x78,0x78,0x38,0x70,0x3C,0xF0,0x34,0xB0,0x37,0xB0,
+    0x37,0xB0,0x33,0x30,0x33,0x30,0x30,0x30,0x7C,0xF8,0x7C,0xF8,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'M'
+    0x00,0x00,0x00,0x00,0x39,0xF0,0x3D,0xF0,0x1C,0x60,0x1E,0x60,0x1E,0x60,0x1B,0x60,
+    0x1B,0x60,0x19,0xE0,0x19,0xE0,0x18,0xE0,0x3E,0xE0,0x3E,0x60,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'N'
+    0x00,0x00,0x00,0x00,0x07,0x80,0x0F,0xC0,0x1C,0xE0,0x38,0x70,0x30,0x30,0x30,0x30,
+    0x30,0x30,0x30,0x30,0x38,0x70,0x1C,0xE0,0x0F,0xC0,0x07,0x80,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'O'
+    0x00,0x00,0x00,0x00,0x3F,0xC0,0x3F,0xE0,0x18,0x70,0x18,0x30,0x18,0x30,0x18,0x70,
+    0x1F,0xE0,0x1F,0xC0,0x18,0x00,0x18,0x00,0x3F,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'P'
+    0x00,0x00,0x00,0x00,0x3F,0xC0,0x3F,0xE0,0x18,0x70,0x18,0x30,0x18,0x70,0x1F,0xE0,
+    0x1F,0xC0,0x18,0xE0,0x18,0x60,0x18,0x70,0x3E,0x38,0x3E,0x18,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'R'
+    0x00,0x00,0x00,0x00,0x0F,0xB0,0x1F,0xF0,0x38,0x70,0x30,0x30,0x38,0x00,0x1F,0x80,
+    0x07,0xE0,0x00,0x70,0x30,0x30,0x38,0x70,0x3F,0xE0,0x37,0xC0,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'S'
+    0x00,0x00,0x00,0x00,0x3F,0xF0,0x3F,0xF0,0x33,0x30,0x33,0x30,0x33,0x30,0x03,0x00,
+    0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x0F,0xC0,0x0F,0xC0,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'T'
+    0x00,0x00,0x00,0x00,0x78,0xF0,0x78,0xF0,0x30,0x60,0x30,0x60,0x18,0xC0,0x18,0xC0,
+    0x0D,0x80,0x0D,0x80,0x0D,0x80,0x07,0x00,0x07,0x00,0x07,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'V'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xC0,0x1F,0xE0,0x00,0x60,
+    0x0F,0xE0,0x1F,0xE0,0x38,0x60,0x30,0xE0,0x3F,0xF0,0x1F,0x70,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'a'
+    0x00,0x00,0x70,0x00,0x70,0x00,0x30,0x00,0x30,0x00,0x37,0x80,0x3F,0xE0,0x38,0x60,
+    0x30,0x30,0x30,0x30,0x30,0x30,0x38,0x60,0x7F,0xE0,0x77,0x80,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'b'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xB0,0x1F,0xF0,0x18,0x30,
+    0x30,0x30,0x30,0x00,0x30,0x00,0x38,0x30,0x1F,0xF0,0x0F,0xC0,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'c'
+    0x00,0x00,0x00,0x70,0x00,0x70,0x00,0x30,0x00,0x30,0x07,0xB0,0x1F,0xF0,0x18,0x70,
+    0x30,0x30,0x30,0x30,0x30,0x30,0x38,0x70,0x1F,0xF8,0x07,0xB8,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'd'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x80,0x1F,0xE0,0x18,0x60,
+    0x3F,0xF0,0x3F,0xF0,0x30,0x00,0x18,0x30,0x1F,0xF0,0x07,0xC0,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'e'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xB8,0x1F,0xF8,0x18,0x70,
+    0x30,0x30,0x30,0x30,0x30,0x30,0x18,0x70,0x1F,0xF0,0x07,0xB0,0x00,0x30,0x00,0x70,
+    0x0F,0xE0,0x0F,0xC0,0x00,0x00,0x00,0x00,  // 'g'
+    0x00,0x00,0x03,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x1F,0x00,0x03,0x00,
+    0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x1F,0xE0,0x1F,0xE0,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'i'
+    0x00,0x00,0x38,0x00,0x38,0x00,0x18,0x00,0x18,0x00,0x1B,0xE0,0x1B,0xE0,0x1B,0x00,
+    0x1E,0x00,0x1E,0x00,0x1B,0x00,0x19,0x80,0x39,0xF0,0x39,0xF0,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'k'
+    0x00,0x00,0x1F,0x00,0x1F,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+    0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x1F,0xE0,0x1F,0xE0,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'l'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0xE0,0x7F,0xF0,0x33,0x30,
+    0x33,0x30,0x33,0x30,0x33,0x30,0x33,0x30,0x7B,0xB8,0x7B,0xB8,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'm'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3B,0xC0,0x3F,0xE0,0x1C,0x60,
+    0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x3C,0xF0,0x3C,0xF0,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'n'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x80,0x1F,0xE0,0x18,0x60,
+    0x30,0x30,0x30,0x30,0x30,0x30,0x18,0x60,0x1F,0xE0,0x07,0x80,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'o'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x77,0x80,0x7F,0xE0,0x38,0x60,
+    0x30,0x30,0x30,0x30,0x30,0x30,0x38,0x60,0x3F,0xE0,0x37,0x80,0x30,0x00,0x30,0x00,
+    0x7C,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,  // 'p'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xE0,0x3D,0xF0,0x0F,0x30,
+    0x0E,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x3F,0xC0,0x3F,0xC0,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'r'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xE0,0x1F,0xE0,0x18,0x60,
+    0x1E,0x00,0x0F,0xC0,0x01,0xE0,0x18,0x60,0x1F,0xE0,0x1F,0x80,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 's'
+    0x00,0x00,0x00,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x3F,0xE0,0x3F,0xE0,0x0C,0x00,
+    0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x30,0x0F,0xF0,0x07,0xC0,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 't'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0xE0,0x38,0xE0,0x18,0x60,
+    0x18,0x60,0x18,0x60,0x18,0x60,0x18,0xE0,0x1F,0xF0,0x0F,0x70,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'u'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0xF0,0x78,0xF0,0x30,0x60,
+    0x18,0xC0,0x18,0xC0,0x0D,0x80,0x0D,0x80,0x07,0x00,0x07,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'v'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xF0,0x3C,0xF0,0x0C,0xC0,
+    0x07,0x80,0x03,0x00,0x07,0x80,0x0C,0xC0,0x3C,0xF0,0x3C,0xF0,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'x'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0xF0,0x78,0xF0,0x30,0x60,
+    0x18,0xC0,0x18,0xC0,0x0D,0x80,0x0F,0x80,0x07,0x00,0x06,0x00,0x06,0x00,0x0C,0x00,
+    0x7F,0x00,0x7F,0x00,0x00,0x00,0x00,0x00,  // 'y'
+};
+
+sFONT Font20 = { Font20_Table, 14, 20, Font20_Map };
+
+static const uint8_t Font24_Map[95] = {
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11,  0,  0,  0,  0,  0,
+     0, 12,  0, 13,  0, 14, 15,  0,  0, 16,  0,  0, 17, 18, 19, 20,
+    21,  0, 22, 23, 24,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0, 26, 27, 28, 29, 30,  0, 31,  0, 32,  0, 33, 34, 35, 36, 37,
+    38,  0, 39, 40, 41, 42, 43,  0, 44, 45,  0,  0,  0,  0,  0,
+};
+
+static const uint8_t Font24_Table[] = {
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // ' '
+    0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xC0,0x00,0x07,0xE0,0x00,0x0C,0x30,0x00,0x0C,
+    0x30,0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x18,0x18,
+    0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x0C,0x30,0x00,0x0C,0x30,0x00,0x07,0xE0,0x00,
+    0x03,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '0'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x07,0x80,0x00,0x1F,0x80,0x00,0x1D,
+    0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,
+    0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x1F,0xF8,0x00,
+    0x1F,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '1'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xC0,0x00,0x1F,0xF0,0x00,0x38,0x30,0x00,0x30,
+    0x18,0x00,0x30,0x18,0x00,0x00,0x18,0x00,0x00,0x30,0x00,0x00,0x60,0x00,0x01,0xC0,
+    0x00,0x03,0x80,0x00,0x06,0x00,0x00,0x0C,0x00,0x00,0x18,0x00,0x00,0x3F,0xF8,0x00,
+    0x3F,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '2'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xC0,0x00,0x0F,0xE0,0x00,0x0C,0x70,0x00,0x00,
+    0x30,0x00,0x00,0x30,0x00,0x00,0x60,0x00,0x03,0xC0,0x00,0x03,0xE0,0x00,0x00,0x70,
+    0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x18,0x38,0x00,0x1F,0xF0,0x00,
+    0x0F,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '3'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x01,0xE0,0x00,0x01,0xE0,0x00,0x03,
+    0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x0C,0x60,0x00,0x0C,0x60,0x00,0x18,0x60,
+    0x00,0x30,0x60,0x00,0x3F,0xF8,0x00,0x3F,0xF8,0x00,0x00,0x60,0x00,0x03,0xF8,0x00,
+    0x03,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '4'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xF0,0x00,0x1F,0xF0,0x00,0x18,0x00,0x00,0x18,
+    0x00,0x00,0x18,0x00,0x00,0x1B,0xC0,0x00,0x1F,0xF0,0x00,0x1C,0x30,0x00,0x00,0x18,
+    0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x30,0x30,0x00,0x3F,0xF0,0x00,
+    0x0F,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '5'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x03,0xF8,0x00,0x07,0x00,0x00,0x0E,
+    0x00,0x00,0x0C,0x00,0x00,0x18,0x00,0x00,0x1B,0xC0,0x00,0x1F,0xF0,0x00,0x1C,0x30,
+    0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x0C,0x38,0x00,0x0F,0xF0,0x00,
+    0x03,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '6'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xF8,0x00,0x1F,0xF8,0x00,0x18,0x18,0x00,0x18,
+    0x38,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x70,0x00,0x00,0x60,0x00,0x00,0x60,
+    0x00,0x00,0xE0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x01,0xC0,0x00,0x01,0x80,0x00,
+    0x01,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '7'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xE0,0x00,0x0F,0xF0,0x00,0x1C,0x38,0x00,0x18,
+    0x18,0x00,0x18,0x18,0x00,0x0C,0x30,0x00,0x07,0xE0,0x00,0x07,0xE0,0x00,0x0C,0x30,
+    0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x1C,0x38,0x00,0x0F,0xF0,0x00,
+    0x07,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '8'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xC0,0x00,0x0F,0xF0,0x00,0x1C,0x30,0x00,0x18,
+    0x18,0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x0C,0x38,0x00,0x0F,0xF8,0x00,0x03,0xD8,
+    0x00,0x00,0x18,0x00,0x00,0x30,0x00,0x00,0x70,0x00,0x00,0xE0,0x00,0x1F,0xC0,0x00,
+    0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '9'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x03,0xC0,0x00,0x03,0xC0,0x00,0x03,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xC0,0x00,0x03,0xC0,0x00,
+    0x03,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // ':'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x80,0x00,0x1F,0xC0,0x00,0x01,
+    0xC0,0x00,0x03,0x60,0x00,0x03,0x60,0x00,0x06,0x30,0x00,0x06,0x30,0x00,0x0C,0x30,
+    0x00,0x0F,0xF8,0x00,0x1F,0xF8,0x00,0x18,0x0C,0x00,0x30,0x0C,0x00,0xFC,0x7F,0x00,
+    0xFC,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'A'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xEC,0x00,0x0F,0xFC,0x00,0x1C,
+    0x1C,0x00,0x18,0x0C,0x00,0x30,0x0C,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,
+    0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x18,0x0C,0x00,0x1C,0x1C,0x00,0x0F,0xF8,0x00,
+    0x03,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'C'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xF8,0x00,0x7F,0xF8,0x00,0x18,
+    0x18,0x00,0x18,0x18,0x00,0x19,0x98,0x00,0x19,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,
+    0x00,0x19,0x80,0x00,0x19,0x98,0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x7F,0xF8,0x00,
+    0x7F,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'E'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xFC,0x00,0x3F,0xFC,0x00,0x0C,
+    0x0C,0x00,0x0C,0x0C,0x00,0x0C,0xCC,0x00,0x0C,0xC0,0x00,0x0F,0xC0,0x00,0x0F,0xC0,
+    0x00,0x0C,0xC0,0x00,0x0C,0xC0,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x3F,0xC0,0x00,
+    0x3F,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'F'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xF8,0x00,0x1F,0xF8,0x00,0x01,
+    0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,
+    0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x1F,0xF8,0x00,
+    0x1F,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'I'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x80,0x00,0x7F,0x80,0x00,0x0C,
+    0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,
+    0x00,0x0C,0x0C,0x00,0x0C,0x0C,0x00,0x0C,0x0C,0x00,0x0C,0x0C,0x00,0x7F,0xFC,0x00,
+    0x7F,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'L'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x0F,0x00,0xF8,0x1F,0x00,0x38,
+    0x1C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x36,0x6C,0x00,0x36,0x6C,0x00,0x33,0xCC,
+    0x00,0x33,0xCC,0x00,0x31,0x8C,0x00,0x30,0x0C,0x00,0x30,0x0C,0x00,0xFE,0x7F,0x00,
+    0xFE,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'M'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0xFE,0x00,0x78,0xFE,0x00,0x1C,
+    0x18,0x00,0x1E,0x18,0x00,0x1F,0x18,0x00,0x1B,0x18,0x00,0x1B,0x98,0x00,0x19,0xD8,
+    0x00,0x18,0xD8,0x00,0x18,0xF8,0x00,0x18,0x78,0x00,0x18,0x38,0x00,0x7F,0x18,0x00,
+    0x7F,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'N'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xC0,0x00,0x0F,0xF0,0x00,0x1C,
+    0x38,0x00,0x18,0x18,0x00,0x38,0x1C,0x00,0x30,0x0C,0x00,0x30,0x0C,0x00,0x30,0x0C,
+    0x00,0x30,0x0C,0x00,0x38,0x1C,0x00,0x18,0x18,0x00,0x1C,0x38,0x00,0x0F,0xF0,0x00,
+    0x03,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'O'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xF0,0x00,0x3F,0xF8,0x00,0x0C,
+    0x1C,0x00,0x0C,0x0C,0x00,0x0C,0x0C,0x00,0x0C,0x0C,0x00,0x0C,0x18,0x00,0x0F,0xF8,
+    0x00,0x0F,0xE0,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x3F,0xC0,0x00,
+    0x3F,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'P'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xE0,0x00,0x7F,0xF0,0x00,0x18,
+    0x38,0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x18,0x38,0x00,0x1F,0xF0,0x00,0x1F,0xC0,
+    0x00,0x18,0xE0,0x00,0x18,0x70,0x00,0x18,0x30,0x00,0x18,0x38,0x00,0x7F,0x1E,0x00,
+    0x7F,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'R'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xD8,0x00,0x0F,0xF8,0x00,0x1C,
+    0x38,0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x1E,0x00,0x00,0x0F,0xC0,0x00,0x03,0xF0,
+    0x00,0x00,0x78,0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x1C,0x38,0x00,0x1F,0xF0,0x00,
+    0x1B,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'S'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xFC,0x00,0x3F,0xFC,0x00,0x31,
+    0x8C,0x00,0x31,0x8C,0x00,0x31,0x8C,0x00,0x31,0x8C,0x00,0x01,0x80,0x00,0x01,0x80,
+    0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x0F,0xF0,0x00,
+    0x0F,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'T'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x7F,0x00,0x7F,0x7F,0x00,0x18,
+    0x0C,0x00,0x0C,0x18,0x00,0x0C,0x18,0x00,0x0C,0x18,0x00,0x06,0x30,0x00,0x06,0x30,
+    0x00,0x03,0x60,0x00,0x03,0x60,0x00,0x03,0x60,0x00,0x01,0xC0,0x00,0x01,0xC0,0x00,
+    0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'V'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x0F,0xC0,0x00,0x1F,0xE0,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x07,0xF0,
+    0x00,0x1F,0xF0,0x00,0x38,0x30,0x00,0x30,0x30,0x00,0x30,0x70,0x00,0x1F,0xFC,0x00,
+    0x0F,0xBC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'a'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x18,0x00,0x00,0x18,
+    0x00,0x00,0x1B,0xE0,0x00,0x1F,0xF8,0x00,0x1C,0x18,0x00,0x18,0x0C,0x00,0x18,0x0C,
+    0x00,0x18,0x0C,0x00,0x18,0x0C,0x00,0x18,0x0C,0x00,0x1C,0x18,0x00,0x7F,0xF8,0x00,
+    0x7B,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'b'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x03,0xEC,0x00,0x0F,0xFC,0x00,0x1C,0x1C,0x00,0x38,0x0C,0x00,0x30,0x0C,
+    0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x38,0x0C,0x00,0x1C,0x1C,0x00,0x0F,0xF8,0x00,
+    0x03,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'c'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x18,0x00,0x00,
+    0x18,0x00,0x07,0xD8,0x00,0x1F,0xF8,0x00,0x18,0x38,0x00,0x30,0x18,0x00,0x30,0x18,
+    0x00,0x30,0x18,0x00,0x30,0x18,0x00,0x30,0x18,0x00,0x18,0x38,0x00,0x1F,0xFE,0x00,
+    0x07,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'd'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x07,0xE0,0x00,0x1F,0xF8,0x00,0x18,0x18,0x00,0x30,0x0C,0x00,0x3F,0xFC,
+    0x00,0x3F,0xFC,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x18,0x0C,0x00,0x1F,0xFC,0x00,
+    0x07,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'e'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x07,0xDE,0x00,0x1F,0xFE,0x00,0x18,0x38,0x00,0x30,0x18,0x00,0x30,0x18,
+    0x00,0x30,0x18,0x00,0x30,0x18,0x00,0x30,0x18,0x00,0x18,0x38,0x00,0x1F,0xF8,0x00,
+    0x07,0xD8,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x38,0x00,0x0F,0xF0,0x00,0x0F,
+    0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'g'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,
+    0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x3F,0xFC,0x00,
+    0x3F,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'i'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x0C,0x00,0x00,0x0C,
+    0x00,0x00,0x0C,0xF8,0x00,0x0C,0xF8,0x00,0x0C,0xC0,0x00,0x0D,0x80,0x00,0x0F,0x80,
+    0x00,0x0F,0x00,0x00,0x0F,0x80,0x00,0x0D,0xC0,0x00,0x0C,0xE0,0x00,0x3C,0x7C,0x00,
+    0x3C,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'k'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x01,0x80,0x00,0x01,
+    0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,
+    0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x3F,0xFC,0x00,
+    0x3F,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'l'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0xF7,0x78,0x00,0xFF,0xFC,0x00,0x39,0xCC,0x00,0x31,0x8C,0x00,0x31,0x8C,
+    0x00,0x31,0x8C,0x00,0x31,0x8C,0x00,0x31,0x8C,0x00,0x31,0x8C,0x00,0xFD,0xEF,0x00,
+    0xFD,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'm'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x7B,0xE0,0x00,0x7F,0xF0,0x00,0x1C,0x38,0x00,0x18,0x18,0x00,0x18,0x18,
+    0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x7E,0x7E,0x00,
+    0x7E,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'n'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x03,0xC0,0x00,0x0F,0xF0,0x00,0x1C,0x38,0x00,0x38,0x1C,0x00,0x30,0x0C,
+    0x00,0x30,0x0C,0x00,0x30,0x0C,0x00,0x38,0x1C,0x00,0x1C,0x38,0x00,0x0F,0xF0,0x00,
+    0x03,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'o'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x7B,0xE0,0x00,0x7F,0xF8,0x00,0x1C,0x18,0x00,0x18,0x0C,0x00,0x18,0x0C,
+    0x00,0x18,0x0C,0x00,0x18,0x0C,0x00,0x18,0x0C,0x00,0x1C,0x18,0x00,0x1F,0xF8,0x00,
+    0x1B,0xE0,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x7F,0x00,0x00,0x7F,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'p'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x3E,0x78,0x00,0x3E,0xFC,0x00,0x07,0xCC,0x00,0x07,0x00,0x00,0x06,0x00,
+    0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x3F,0xF0,0x00,
+    0x3F,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'r'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x07,0xF8,0x00,0x0F,0xF8,0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x1F,0x80,
+    0x00,0x0F,0xF0,0x00,0x00,0xF8,0x00,0x18,0x18,0x00,0x18,0x38,0x00,0x1F,0xF0,0x00,
+    0x1F,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 's'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,
+    0x00,0x00,0x3F,0xF0,0x00,0x3F,0xF0,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,
+    0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x1C,0x00,0x07,0xFC,0x00,
+    0x03,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 't'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x78,0x78,0x00,0x78,0x78,0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x18,0x18,
+    0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x18,0x38,0x00,0x0F,0xFE,0x00,
+    0x07,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'u'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x7C,0x3E,0x00,0x7C,0x3E,0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x0C,0x30,
+    0x00,0x0C,0x30,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x07,0xE0,0x00,0x03,0xC0,0x00,
+    0x03,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'v'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x3E,0x7C,0x00,0x3E,0x7C,0x00,0x0C,0x30,0x00,0x06,0x60,0x00,0x03,0xC0,
+    0x00,0x01,0x80,0x00,0x03,0xC0,0x00,0x06,0x60,0x00,0x0C,0x30,0x00,0x3E,0x7C,0x00,
+    0x3E,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'x'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x7E,0x1F,0x00,0x7E,0x1F,0x00,0x18,0x0C,0x00,0x0C,0x18,0x00,0x0C,0x18,
+    0x00,0x06,0x30,0x00,0x06,0x30,0x00,0x03,0x60,0x00,0x03,0xE0,0x00,0x01,0xC0,0x00,
+    0x00,0xC0,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x03,0x00,0x00,0x3F,0xC0,0x00,0x3F,
+    0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'y'
+};
+
+sFONT Font24 = { Font24_Table, 17, 24, Font24_Map };
+
+static const uint8_t Font32_Map[95] = {
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11,  0,  0,  0,  0,  0,
+     0, 12,  0, 13,  0, 14, 15,  0,  0, 16,  0,  0, 17, 18, 19, 20,
+    21,  0, 22, 23, 24,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0, 26, 27, 28, 29, 30,  0, 31,  0, 32,  0, 33, 34, 35, 36, 37,
+    38,  0, 39, 40, 41, 42, 43,  0, 44, 45,  0,  0,  0,  0,  0,
+};
+
+static const uint8_t Font32_Table[] = {
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // ' '
+    0x00,0x00,0x00,0x00,0x03,0xC0,0x07,0xE0,0x0F,0xF0,0x1F,0xF8,0x1F,0xF8,0x1E,0x3C,
+    0x3C,0x3C,0x3C,0x3C,0x3C,0x7C,0x3C,0x7C,0x3C,0xFC,0x3C,0xDE,0x3D,0x9E,0x39,0x9E,
+    0x3B,0x1E,0x3F,0x1C,0x3F,0x1C,0x3E,0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x1E,0x7C,
+    0x1F,0xF8,0x1F,0xF8,0x0F,0xF0,0x07,0xE0,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,  // '0'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xE0,0x1F,0xE0,0x1F,0xE0,0x1F,0xE0,0x1D,0xE0,
+    0x01,0xE0,0x01,0xE0,0x01,0xE0,0x01,0xE0,0x01,0xE0,0x01,0xE0,0x01,0xE0,0x01,0xE0,
+    0x01,0xE0,0x01,0xE0,0x01,0xE0,0x01,0xE0,0x01,0xE0,0x01,0xE0,0x01,0xE0,0x01,0xE0,
+    0x1F,0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '1'
+    0x00,0x00,0x00,0x00,0x07,0x80,0x3F,0xE0,0x3F,0xF0,0x3F,0xF8,0x38,0xFC,0x20,0x7C,
+    0x00,0x3C,0x00,0x3C,0x00,0x3C,0x00,0x3C,0x00,0x78,0x00,0x78,0x00,0xF0,0x01,0xF0,
+    0x01,0xE0,0x03,0xC0,0x07,0xC0,0x07,0x80,0x0F,0x00,0x1E,0x00,0x1C,0x00,0x3C,0x00,
+    0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '2'
+    0x00,0x00,0x00,0x00,0x07,0xC0,0x1F,0xF0,0x3F,0xF8,0x3F,0xF8,0x3F,0xFC,0x00,0x3C,
+    0x00,0x3C,0x00,0x3C,0x00,0x3C,0x00,0x78,0x07,0xF8,0x07,0xF0,0x07,0xE0,0x07,0xF0,
+    0x03,0xF8,0x00,0x3C,0x00,0x3C,0x00,0x1C,0x00,0x1C,0x00,0x1C,0x00,0x3C,0x20,0x3C,
+    0x3F,0xFC,0x3F,0xF8,0x3F,0xF8,0x3F,0xE0,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '3'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0xF8,0x01,0xF8,0x01,0xF8,0x03,0xF8,
+    0x03,0xF8,0x03,0xF8,0x07,0x78,0x07,0x78,0x0E,0x78,0x0E,0x78,0x1C,0x78,0x1C,0x78,
+    0x38,0x78,0x38,0x78,0x7F,0xFE,0x7F,0xFE,0x7F,0xFE,0x7F,0xFE,0x3F,0xFC,0x00,0x78,
+    0x00,0x78,0x00,0x78,0x00,0x78,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '4'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xF8,0x1F,0xF8,0x1F,0xF8,0x1F,0xF8,0x1C,0x00,
+    0x1C,0x00,0x1C,0x00,0x1C,0x00,0x1D,0x80,0x1F,0xE0,0x1F,0xF0,0x1F,0xF8,0x1F,0xFC,
+    0x00,0x7C,0x00,0x3C,0x00,0x1C,0x00,0x1C,0x00,0x1C,0x00,0x1C,0x00,0x3C,0x20,0x7C,
+    0x3F,0xF8,0x3F,0xF8,0x3F,0xF0,0x3F,0xE0,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '5'
+    0x00,0x00,0x00,0x00,0x00,0xE0,0x03,0xF8,0x07,0xFC,0x0F,0xF8,0x1F,0x9C,0x1E,0x00,
+    0x1C,0x00,0x3C,0x00,0x3C,0x00,0x3C,0xC0,0x39,0xF0,0x3F,0xF8,0x3F,0xFC,0x3F,0x7C,
+    0x3E,0x3C,0x3C,0x1E,0x3C,0x1E,0x3C,0x1E,0x3C,0x1E,0x3C,0x1E,0x3C,0x1E,0x1E,0x3C,
+    0x1F,0xFC,0x0F,0xFC,0x0F,0xF8,0x07,0xF0,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,  // '6'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x00,0x3C,
+    0x00,0x38,0x00,0x78,0x00,0x78,0x00,0x78,0x00,0xF0,0x00,0xF0,0x00,0xF0,0x01,0xE0,
+    0x01,0xE0,0x01,0xE0,0x03,0xC0,0x03,0xC0,0x03,0xC0,0x03,0xC0,0x07,0x80,0x07,0x80,
+    0x07,0x80,0x0F,0x00,0x0F,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '7'
+    0x00,0x00,0x00,0x00,0x03,0xC0,0x0F,0xF0,0x0F,0xF8,0x1F,0xF8,0x1E,0x7C,0x3C,0x3C,
+    0x3C,0x3C,0x3C,0x1C,0x3C,0x3C,0x1C,0x3C,0x1E,0x78,0x0F,0xF0,0x07,0xF0,0x0F,0xF0,
+    0x1F,0xF8,0x3C,0x3C,0x3C,0x1C,0x38,0x1C,0x38,0x1C,0x38,0x1C,0x38,0x1C,0x3C,0x3C,
+    0x3F,0xFC,0x1F,0xF8,0x1F,0xF8,0x0F,0xF0,0x01,0x80,0x00,0x00,0x00,0x00,0x00,0x00,  // '8'
+    0x00,0x00,0x00,0x00,0x01,0x00,0x07,0xE0,0x1F,0xF0,0x1F,0xF8,0x3E,0x78,0x3C,0x3C,
+    0x38,0x3C,0x38,0x3C,0x38,0x3C,0x38,0x3C,0x38,0x3C,0x3C,0x3C,0x3C,0x3E,0x3F,0xFE,
+    0x1F,0xFE,0x1F,0xFC,0x0F,0xDC,0x03,0x1C,0x00,0x1C,0x00,0x3C,0x00,0x3C,0x00,0x78,
+    0x1C,0xF8,0x1F,0xF0,0x1F,0xF0,0x1F,0xE0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '9'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x03,0xC0,0x03,0xE0,0x03,0xE0,0x03,0xE0,0x03,0xE0,0x03,0xE0,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xC0,0x03,0xE0,0x03,0xE0,0x03,0xE0,
+    0x03,0xE0,0x03,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // ':'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xC0,0x07,0xC0,0x07,0xE0,0x07,0xE0,0x0F,0xE0,
+    0x0F,0xE0,0x0E,0xE0,0x0E,0xF0,0x0E,0xF0,0x1E,0x70,0x1E,0x70,0x1C,0x70,0x1C,0x78,
+    0x1C,0x78,0x3C,0x78,0x3F,0xF8,0x3F,0xF8,0x3F,0xFC,0x7F,0xFC,0x78,0x3C,0x78,0x1C,
+    0x78,0x1E,0x70,0x1E,0xF0,0x1E,0xF0,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'A'
+    0x00,0x00,0x00,0x00,0x00,0xF0,0x03,0xFC,0x07,0xFC,0x0F,0xFC,0x1F,0xFC,0x1F,0x0C,
+    0x1E,0x00,0x3E,0x00,0x3C,0x00,0x3C,0x00,0x3C,0x00,0x3C,0x00,0x3C,0x00,0x3C,0x00,
+    0x3C,0x00,0x3C,0x00,0x3C,0x00,0x3C,0x00,0x3C,0x00,0x3E,0x00,0x1E,0x04,0x1F,0x0C,
+    0x1F,0xFC,0x0F,0xFC,0x07,0xFC,0x03,0xF8,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,  // 'C'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3C,0x00,
+    0x3C,0x00,0x3C,0x00,0x3C,0x00,0x3C,0x00,0x3C,0x00,0x3F,0xF8,0x3F,0xF8,0x3F,0xF8,
+    0x3F,0xF8,0x3C,0x00,0x3C,0x00,0x3C,0x00,0x3C,0x00,0x3C,0x00,0x3C,0x00,0x3C,0x00,
+    0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'E'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3C,0x00,
+    0x3C,0x00,0x3C,0x00,0x3C,0x00,0x3C,0x00,0x3C,0x00,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,
+    0x3F,0xFC,0x3C,0x00,0x3C,0x00,0x3C,0x00,0x3C,0x00,0x3C,0x00,0x3C,0x00,0x3C,0x00,
+    0x3C,0x00,0x3C,0x00,0x3C,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'F'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x03,0xC0,
+    0x03,0xC0,0x03,0xC0,0x03,0xC0,0x03,0xC0,0x03,0xC0,0x03,0xC0,0x03,0xC0,0x03,0xC0,
+    0x03,0xC0,0x03,0xC0,0x03,0xC0,0x03,0xC0,0x03,0xC0,0x03,0xC0,0x03,0xC0,0x03,0xC0,
+    0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'I'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0x00,0x1E,0x00,0x1E,0x00,0x1E,0x00,0x1E,0x00,
+    0x1E,0x00,0x1E,0x00,0x1E,0x00,0x1E,0x00,0x1E,0x00,0x1E,0x00,0x1E,0x00,0x1E,0x00,
+    0x1E,0x00,0x1E,0x00,0x1E,0x00,0x1E,0x00,0x1E,0x00,0x1E,0x00,0x1E,0x00,0x1E,0x00,
+    0x1F,0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'L'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x3E,0x7C,0x3E,0x7C,0x3E,0x7C,0x7E,0x7C,0x7E,
+    0x7E,0x7E,0x7E,0x7E,0x7E,0x7E,0x76,0xEE,0x77,0xCE,0x77,0xCE,0x73,0xCE,0x73,0xDE,
+    0x73,0xDE,0x73,0xDE,0x73,0x9E,0x70,0x1E,0x70,0x1E,0x70,0x1E,0x70,0x1E,0x70,0x1E,
+    0x70,0x1E,0x70,0x1E,0x70,0x1E,0x70,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'M'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x1C,0x7C,0x1C,0x7C,0x1C,0x7E,0x1C,0x7E,0x1C,
+    0x7E,0x1C,0x7E,0x1C,0x7F,0x1C,0x7F,0x1C,0x7B,0x1C,0x7B,0x9C,0x7B,0x9C,0x7B,0x9C,
+    0x79,0x9C,0x79,0xDC,0x79,0xDC,0x78,0xFC,0x78,0xFC,0x78,0xFC,0x78,0x7C,0x78,0x7C,
+    0x78,0x7C,0x78,0x7C,0x78,0x3C,0x78,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'N'
+    0x00,0x00,0x00,0x00,0x03,0xC0,0x0F,0xE0,0x0F,0xF0,0x1F,0xF8,0x3F,0xF8,0x3E,0x7C,
+    0x3C,0x3C,0x3C,0x3C,0x78,0x3C,0x78,0x1E,0x78,0x1E,0x78,0x1E,0x78,0x1E,0x78,0x1E,
+    0x78,0x1E,0x78,0x1E,0x78,0x1E,0x78,0x1E,0x78,0x3C,0x3C,0x3C,0x3C,0x3C,0x3E,0x7C,
+    0x1F,0xF8,0x1F,0xF8,0x0F,0xF0,0x07,0xE0,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'O'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xE0,0x3F,0xF8,0x3F,0xFC,0x3F,0xFC,0x3C,0x3C,
+    0x3C,0x3E,0x3C,0x1E,0x3C,0x1E,0x3C,0x1E,0x3C,0x1E,0x3C,0x3E,0x3F,0xFC,0x3F,0xFC,
+    0x3F,0xF8,0x3F,0xF0,0x3F,0x00,0x3C,0x00,0x3C,0x00,0x3C,0x00,0x3C,0x00,0x3C,0x00,
+    0x3C,0x00,0x3C,0x00,0x3C,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'P'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xE0,0x3F,0xF8,0x3F,0xF8,0x3F,0xFC,0x3C,0x7C,
+    0x38,0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x38,0x3C,0x3C,0x78,0x3F,0xF8,0x3F,0xF0,
+    0x3F,0xE0,0x3F,0xF0,0x3C,0xF0,0x38,0xF8,0x3C,0x78,0x3C,0x78,0x3C,0x3C,0x3C,0x3C,
+    0x3C,0x3E,0x3C,0x1E,0x3C,0x1E,0x38,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'R'
+    0x00,0x00,0x00,0x00,0x03,0xC0,0x0F,0xF0,0x1F,0xF8,0x3F,0xF8,0x3E,0x78,0x3C,0x18,
+    0x38,0x00,0x78,0x00,0x7C,0x00,0x3C,0x00,0x3F,0x00,0x3F,0xC0,0x1F,0xF0,0x0F,0xF8,
+    0x03,0xF8,0x01,0xFC,0x00,0x7C,0x00,0x3C,0x00,0x3C,0x00,0x3C,0x60,0x3C,0x30,0x3C,
+    0x3F,0xFC,0x3F,0xF8,0x3F,0xF8,0x1F,0xE0,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'S'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFE,0x7F,0xFE,0x7F,0xFE,0x7F,0xFE,0x03,0xC0,
+    0x03,0xC0,0x03,0xC0,0x03,0xC0,0x03,0xC0,0x03,0xC0,0x03,0xC0,0x03,0xC0,0x03,0xC0,
+    0x03,0xC0,0x03,0xC0,0x03,0xC0,0x03,0xC0,0x03,0xC0,0x03,0xC0,0x03,0xC0,0x03,0xC0,
+    0x03,0xC0,0x03,0xC0,0x03,0xC0,0x03,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'T'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x1E,0x78,0x1E,0x78,0x1E,0x78,0x1E,0x38,0x1C,
+    0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x1C,0x38,0x1C,0x38,0x1C,0x78,0x1E,0x78,
+    0x1E,0x78,0x1E,0x78,0x0E,0x70,0x0E,0x70,0x0E,0x70,0x0E,0x70,0x0F,0xF0,0x07,0xE0,
+    0x07,0xE0,0x07,0xE0,0x07,0xE0,0x07,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'V'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x1F,0xF0,0x3F,0xF8,0x3F,0xF8,0x3C,0x7C,0x30,0x3C,0x00,0x3C,0x01,0xFC,
+    0x1F,0xFC,0x3F,0xFC,0x3F,0xFC,0x7C,0x3C,0x78,0x3C,0x78,0x3C,0x78,0x3C,0x78,0x3C,
+    0x7C,0x7C,0x3F,0xFC,0x3F,0xFC,0x1F,0x9C,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'a'
+    0x00,0x00,0x00,0x00,0x3C,0x00,0x3C,0x00,0x3C,0x00,0x3C,0x00,0x3C,0x00,0x3C,0x00,
+    0x3C,0x00,0x39,0xF0,0x3B,0xF8,0x3F,0xF8,0x3F,0xFC,0x3E,0x3C,0x3C,0x3C,0x3C,0x1C,
+    0x3C,0x1E,0x3C,0x1E,0x38,0x1E,0x38,0x1E,0x3C,0x1E,0x3C,0x1C,0x3C,0x3C,0x3E,0x3C,
+    0x3F,0xFC,0x3F,0xF8,0x3B,0xF8,0x39,0xF0,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,  // 'b'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x03,0xF0,0x0F,0xF8,0x0F,0xFC,0x1F,0xFC,0x1E,0x0C,0x3E,0x00,0x3C,0x00,
+    0x3C,0x00,0x3C,0x00,0x3C,0x00,0x3C,0x00,0x3C,0x00,0x3C,0x00,0x3E,0x00,0x1E,0x0C,
+    0x1F,0xFC,0x0F,0xFC,0x0F,0xFC,0x07,0xF8,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,  // 'c'
+    0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x3C,0x00,0x3C,0x00,0x3C,0x00,0x3C,0x00,0x3C,
+    0x00,0x3C,0x0F,0x3C,0x1F,0xBC,0x3F,0xFC,0x3F,0xFC,0x3C,0x7C,0x78,0x7C,0x78,0x3C,
+    0x78,0x3C,0x78,0x3C,0x78,0x3C,0x78,0x3C,0x78,0x3C,0x78,0x3C,0x78,0x3C,0x7C,0x7C,
+    0x3F,0xFC,0x3F,0xFC,0x1F,0xBC,0x0F,0xBC,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'd'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x07,0xE0,0x0F,0xF8,0x1F,0xF8,0x3F,0xFC,0x3C,0x3C,0x38,0x1E,0x78,0x1E,
+    0x7F,0xFE,0x7F,0xFE,0x7F,0xFE,0x7F,0xFE,0x78,0x00,0x78,0x00,0x38,0x00,0x3C,0x04,
+    0x3F,0x3C,0x1F,0xFC,0x0F,0xFC,0x07,0xF8,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,  // 'e'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x0F,0x9C,0x1F,0xFC,0x3F,0xFC,0x3E,0x7C,0x3C,0x3C,0x78,0x3C,0x78,0x3C,
+    0x78,0x3C,0x78,0x3C,0x78,0x3C,0x78,0x3C,0x7C,0x3C,0x3C,0x7C,0x3F,0xFC,0x1F,0xFC,
+    0x0F,0x9C,0x00,0x3C,0x00,0x3C,0x10,0x3C,0x1F,0xF8,0x1F,0xF8,0x1F,0xF0,0x0F,0xC0,  // 'g'
+    0x01,0xC0,0x03,0xC0,0x03,0xC0,0x03,0xC0,0x03,0xC0,0x01,0xC0,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x1F,0xC0,0x1F,0xC0,0x1F,0xC0,0x1F,0xC0,0x01,0xC0,0x01,0xC0,0x03,0xC0,
+    0x03,0xC0,0x03,0xC0,0x03,0xC0,0x03,0xC0,0x03,0xC0,0x03,0xC0,0x01,0xC0,0x01,0xC0,
+    0x3F,0xFE,0x3F,0xFE,0x3F,0xFE,0x3F,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'i'
+    0x00,0x00,0x00,0x00,0x3C,0x00,0x3C,0x00,0x3C,0x00,0x3C,0x00,0x3C,0x00,0x3C,0x00,
+    0x3C,0x00,0x3C,0x3E,0x3C,0x3C,0x3C,0x78,0x3C,0xF8,0x3D,0xF0,0x3D,0xE0,0x3F,0xC0,
+    0x3F,0xC0,0x3F,0xC0,0x3F,0xE0,0x3F,0xE0,0x3C,0xF0,0x3C,0xF0,0x3C,0x78,0x3C,0x78,
+    0x3C,0x3C,0x3C,0x3C,0x3C,0x1E,0x3C,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'k'
+    0x00,0x00,0x00,0x00,0x7F,0x80,0x7F,0x80,0x7F,0x80,0x3F,0x80,0x07,0x80,0x07,0x80,
+    0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,
+    0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,
+    0x07,0xFC,0x03,0xFC,0x03,0xFC,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'l'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x67,0x3C,0x7F,0xFC,0x7F,0xFE,0x7B,0xDE,0x73,0xCE,0x73,0x8E,0x73,0x8E,
+    0x73,0xCE,0x73,0xCE,0x73,0xCE,0x73,0xCE,0x73,0xCE,0x73,0xCE,0x73,0xCE,0x73,0xCE,
+    0x73,0xCE,0x73,0xCE,0x73,0xCE,0x73,0x8E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'm'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x3D,0xF0,0x3D,0xF8,0x3F,0xF8,0x3F,0xFC,0x3E,0x3C,0x3C,0x3C,0x3C,0x3C,
+    0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,
+    0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'n'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x07,0xE0,0x0F,0xF0,0x1F,0xF8,0x3F,0xF8,0x3C,0x3C,0x3C,0x3C,0x78,0x1C,
+    0x78,0x1E,0x78,0x1E,0x78,0x1E,0x78,0x1E,0x78,0x1E,0x78,0x1C,0x38,0x3C,0x3C,0x3C,
+    0x3F,0xFC,0x1F,0xF8,0x1F,0xF0,0x07,0xE0,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'o'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x39,0xF0,0x3F,0xF8,0x3F,0xFC,0x3E,0x7C,0x3C,0x3C,0x3C,0x1E,0x3C,0x1E,
+    0x3C,0x1E,0x3C,0x1E,0x3C,0x1E,0x3C,0x1E,0x3C,0x1E,0x3E,0x3C,0x3F,0xFC,0x3F,0xF8,
+    0x39,0xF8,0x3C,0xE0,0x3C,0x00,0x3C,0x00,0x3C,0x00,0x3C,0x00,0x3C,0x00,0x3C,0x00,  // 'p'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x0E,0x7C,0x0E,0xFE,0x0F,0xFE,0x0F,0xFE,0x0F,0x82,0x0F,0x00,0x0F,0x00,
+    0x0E,0x00,0x0E,0x00,0x0E,0x00,0x0E,0x00,0x0E,0x00,0x0E,0x00,0x0E,0x00,0x0E,0x00,
+    0x0E,0x00,0x0E,0x00,0x0E,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'r'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x0F,0xF0,0x1F,0xF8,0x1F,0xF8,0x3E,0x38,0x3C,0x08,0x3C,0x00,0x3E,0x00,
+    0x3F,0x80,0x1F,0xE0,0x0F,0xF8,0x07,0xF8,0x00,0xFC,0x00,0x3C,0x00,0x3C,0x20,0x3C,
+    0x38,0x7C,0x3F,0xF8,0x3F,0xF8,0x1F,0xF0,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 's'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,
+    0x07,0x80,0x7F,0xFC,0x7F,0xFC,0x7F,0xFC,0x7F,0xFC,0x07,0x80,0x07,0x80,0x07,0x80,
+    0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,0x07,0x80,
+    0x07,0xFC,0x03,0xFC,0x03,0xFC,0x01,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 't'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,
+    0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x7C,
+    0x3F,0xFC,0x1F,0xFC,0x1F,0xFC,0x0F,0xBC,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'u'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x78,0x1E,0x78,0x1E,0x38,0x1C,0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x1C,0x38,
+    0x1C,0x38,0x1E,0x78,0x1E,0x78,0x0E,0x70,0x0E,0x70,0x0E,0x70,0x0F,0xF0,0x07,0xE0,
+    0x07,0xE0,0x07,0xE0,0x07,0xE0,0x03,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'v'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x7C,0x3E,0x3C,0x3C,0x3E,0x7C,0x1E,0x78,0x0E,0x78,0x0F,0xF0,0x07,0xF0,
+    0x07,0xE0,0x03,0xC0,0x03,0xC0,0x07,0xE0,0x07,0xE0,0x0F,0xF0,0x0F,0x70,0x1E,0x78,
+    0x1E,0x78,0x3C,0x3C,0x3C,0x3E,0x78,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'x'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x78,0x1E,0x78,0x1E,0x38,0x1C,0x3C,0x3C,0x3C,0x3C,0x1C,0x38,0x1E,0x78,
+    0x1E,0x78,0x0E,0x70,0x0E,0x70,0x0F,0xF0,0x07,0xF0,0x07,0xE0,0x07,0xE0,0x03,0xE0,
+    0x03,0xC0,0x03,0xC0,0x03,0xC0,0x07,0x80,0x0F,0x80,0x3F,0x00,0x3F,0x00,0x3C,0x00,  // 'y'
+};
+
+sFONT Font32 = { Font32_Table, 16, 32, Font32_Map };
+
+static const uint8_t Font48_Map[95] = {
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11,  0,  0,  0,  0,  0,
+     0, 12,  0, 13,  0, 14, 15,  0,  0, 16,  0,  0, 17, 18, 19, 20,
+    21,  0, 22, 23, 24,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0, 26, 27, 28, 29, 30,  0, 31,  0, 32,  0, 33, 34, 35, 36, 37,
+    38,  0, 39, 40, 41, 42, 43,  0, 44, 45,  0,  0,  0,  0,  0,
+};
+
+static const uint8_t Font48_Table[] = {
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // ' '
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0xFF,0x00,0x01,
+    0xFF,0xC0,0x03,0xFF,0xC0,0x07,0xFF,0xE0,0x07,0xFF,0xF0,0x0F,0xFF,0xF0,0x0F,0xE3,
+    0xF0,0x0F,0xC3,0xF8,0x0F,0xC1,0xF8,0x1F,0x81,0xF8,0x1F,0x83,0xF8,0x1F,0x83,0xFC,
+    0x1F,0x87,0xFC,0x1F,0x87,0xFC,0x1F,0x8F,0xFC,0x1F,0x8F,0xFC,0x1F,0x8E,0xFC,0x1F,
+    0x9C,0xFC,0x1F,0x9C,0xFC,0x1F,0xB8,0xFC,0x1F,0x38,0xFC,0x1F,0x70,0xFC,0x1F,0xF0,
+    0xFC,0x1F,0xF0,0xFC,0x1F,0xE0,0xFC,0x1F,0xE0,0xFC,0x1F,0xC1,0xFC,0x1F,0xC1,0xF8,
+    0x1F,0x81,0xF8,0x1F,0x81,0xF8,0x0F,0xC3,0xF8,0x0F,0xC3,0xF0,0x0F,0xFF,0xF0,0x07,
+    0xFF,0xF0,0x07,0xFF,0xE0,0x03,0xFF,0xE0,0x01,0xFF,0xC0,0x00,0xFF,0x80,0x00,0x7E,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '0'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x00,0x03,
+    0xFF,0x00,0x0F,0xFF,0x00,0x0F,0xFF,0x00,0x0F,0xFF,0x00,0x0F,0xFF,0x00,0x0F,0xFF,
+    0x00,0x0F,0xBF,0x00,0x0C,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,
+    0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,
+    0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,
+    0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,
+    0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x0F,0xFF,0xFC,0x0F,0xFF,0xFE,0x0F,
+    0xFF,0xFE,0x0F,0xFF,0xFE,0x0F,0xFF,0xFE,0x0F,0xFF,0xFE,0x0F,0xFF,0xFC,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '1'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x07,0xFF,0x00,0x1F,
+    0xFF,0xC0,0x1F,0xFF,0xE0,0x1F,0xFF,0xE0,0x1F,0xFF,0xF0,0x1F,0xCF,0xF0,0x1C,0x03,
+    0xF8,0x18,0x03,0xF8,0x00,0x01,0xF8,0x00,0x01,0xF8,0x00,0x01,0xF8,0x00,0x01,0xF8,
+    0x00,0x01,0xF8,0x00,0x01,0xF8,0x00,0x03,0xF0,0x00,0x03,0xF0,0x00,0x07,0xE0,0x00,
+    0x0F,0xE0,0x00,0x0F,0xC0,0x00,0x1F,0xC0,0x00,0x3F,0x80,0x00,0x3F,0x00,0x00,0x7F,
+    0x00,0x00,0xFE,0x00,0x00,0xFC,0x00,0x01,0xF8,0x00,0x03,0xF8,0x00,0x07,0xF0,0x00,
+    0x07,0xE0,0x00,0x0F,0xC0,0x00,0x1F,0x80,0x00,0x1F,0xFF,0xF8,0x3F,0xFF,0xF8,0x3F,
+    0xFF,0xF8,0x3F,0xFF,0xF8,0x3F,0xFF,0xF8,0x3F,0xFF,0xF8,0x3F,0xFF,0xF8,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '2'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x07,0xFF,0x00,0x0F,
+    0xFF,0xC0,0x1F,0xFF,0xE0,0x1F,0xFF,0xF0,0x1F,0xFF,0xF0,0x1F,0xFF,0xF0,0x1E,0x07,
+    0xF8,0x08,0x01,0xF8,0x00,0x01,0xF8,0x00,0x01,0xF8,0x00,0x01,0xF8,0x00,0x01,0xF8,
+    0x00,0x01,0xF8,0x00,0x03,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE0,0x00,0xFF,0xC0,0x00,
+    0xFF,0x00,0x00,0xFF,0xC0,0x00,0xFF,0xE0,0x00,0xFF,0xF0,0x00,0x07,0xF0,0x00,0x01,
+    0xF8,0x00,0x01,0xF8,0x00,0x00,0xFC,0x00,0x00,0xFC,0x00,0x00,0xFC,0x00,0x00,0xFC,
+    0x00,0x00,0xFC,0x00,0x00,0xFC,0x10,0x01,0xFC,0x1C,0x03,0xF8,0x1F,0xFF,0xF8,0x1F,
+    0xFF,0xF8,0x1F,0xFF,0xF0,0x1F,0xFF,0xE0,0x1F,0xFF,0xC0,0x0F,0xFF,0x80,0x01,0xFE,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '3'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xE0,0x00,
+    0x07,0xF0,0x00,0x0F,0xF0,0x00,0x0F,0xF0,0x00,0x1F,0xF0,0x00,0x1F,0xF0,0x00,0x3F,
+    0xF0,0x00,0x3F,0xF0,0x00,0x7F,0xF0,0x00,0x7F,0xF0,0x00,0xFB,0xF0,0x00,0xF3,0xF0,
+    0x01,0xF3,0xF0,0x01,0xF3,0xF0,0x03,0xE3,0xF0,0x03,0xE3,0xF0,0x07,0xC3,0xF0,0x07,
+    0xC3,0xF0,0x0F,0x83,0xF0,0x0F,0x83,0xF0,0x1F,0x03,0xF0,0x1F,0x03,0xF0,0x3E,0x03,
+    0xE0,0x3F,0xFF,0xFC,0x3F,0xFF,0xFE,0x3F,0xFF,0xFE,0x3F,0xFF,0xFE,0x3F,0xFF,0xFE,
+    0x3F,0xFF,0xFE,0x3F,0xFF,0xFC,0x00,0x03,0xE0,0x00,0x03,0xE0,0x00,0x03,0xF0,0x00,
+    0x03,0xF0,0x00,0x03,0xF0,0x00,0x03,0xF0,0x00,0x03,0xF0,0x00,0x03,0xE0,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '4'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFF,0xF0,0x0F,
+    0xFF,0xF0,0x0F,0xFF,0xF0,0x0F,0xFF,0xF0,0x0F,0xFF,0xF0,0x0F,0xFF,0xF0,0x0F,0xFF,
+    0xF0,0x0F,0x80,0x00,0x0F,0x80,0x00,0x0F,0x80,0x00,0x0F,0x80,0x00,0x0F,0x80,0x00,
+    0x0F,0x80,0x00,0x0F,0xFE,0x00,0x0F,0xFF,0x80,0x0F,0xFF,0xC0,0x0F,0xFF,0xE0,0x0F,
+    0xFF,0xF0,0x0F,0xFF,0xF0,0x0F,0x9F,0xF8,0x0C,0x03,0xF8,0x00,0x01,0xF8,0x00,0x01,
+    0xFC,0x00,0x00,0xFC,0x00,0x00,0xFC,0x00,0x00,0xFC,0x00,0x00,0xFC,0x00,0x00,0xFC,
+    0x00,0x00,0xFC,0x00,0x01,0xFC,0x00,0x01,0xF8,0x1C,0x07,0xF8,0x1F,0xFF,0xF8,0x1F,
+    0xFF,0xF0,0x1F,0xFF,0xE0,0x1F,0xFF,0xE0,0x1F,0xFF,0xC0,0x0F,0xFF,0x00,0x01,0xFC,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '5'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x3F,0xE0,0x00,
+    0xFF,0xF0,0x01,0xFF,0xF0,0x03,0xFF,0xF0,0x03,0xFF,0xF0,0x07,0xFF,0xF0,0x07,0xF0,
+    0x30,0x0F,0xE0,0x10,0x0F,0xC0,0x00,0x0F,0xC0,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,
+    0x1F,0x80,0x00,0x1F,0x9F,0x80,0x1F,0x3F,0xC0,0x1F,0x7F,0xF0,0x1F,0xFF,0xF0,0x1F,
+    0xFF,0xF8,0x1F,0xFF,0xF8,0x1F,0xF3,0xFC,0x1F,0xC1,0xFC,0x1F,0xC0,0xFC,0x1F,0xC0,
+    0xFC,0x1F,0x80,0xFC,0x1F,0x80,0x7C,0x1F,0x80,0x7C,0x1F,0x80,0x7C,0x1F,0x80,0x7C,
+    0x1F,0x80,0xFC,0x0F,0xC0,0xFC,0x0F,0xC0,0xFC,0x0F,0xC1,0xFC,0x0F,0xF3,0xF8,0x07,
+    0xFF,0xF8,0x07,0xFF,0xF0,0x03,0xFF,0xF0,0x01,0xFF,0xE0,0x00,0xFF,0xC0,0x00,0x3F,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '6'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0xF8,0x1F,
+    0xFF,0xF8,0x1F,0xFF,0xF8,0x1F,0xFF,0xF8,0x1F,0xFF,0xF8,0x1F,0xFF,0xF8,0x1F,0xFF,
+    0xF8,0x00,0x01,0xF8,0x00,0x03,0xF0,0x00,0x03,0xF0,0x00,0x03,0xF0,0x00,0x07,0xF0,
+    0x00,0x07,0xE0,0x00,0x07,0xE0,0x00,0x07,0xE0,0x00,0x0F,0xC0,0x00,0x0F,0xC0,0x00,
+    0x0F,0xC0,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x3F,0x80,0x00,0x3F,
+    0x00,0x00,0x3F,0x00,0x00,0x7F,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,
+    0x00,0xFC,0x00,0x00,0xFC,0x00,0x00,0xFC,0x00,0x01,0xF8,0x00,0x01,0xF8,0x00,0x01,
+    0xF8,0x00,0x03,0xF8,0x00,0x03,0xF0,0x00,0x03,0xF0,0x00,0x03,0xF0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '7'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0xFF,0x80,0x03,
+    0xFF,0xC0,0x07,0xFF,0xE0,0x07,0xFF,0xF0,0x0F,0xFF,0xF0,0x0F,0xFF,0xF0,0x0F,0xC3,
+    0xF8,0x1F,0x81,0xF8,0x1F,0x80,0xF8,0x1F,0x80,0xF8,0x1F,0x80,0xF8,0x1F,0x80,0xF8,
+    0x0F,0x81,0xF8,0x0F,0x81,0xF0,0x0F,0xC3,0xF0,0x07,0xFF,0xF0,0x03,0xFF,0xE0,0x01,
+    0xFF,0x80,0x01,0xFF,0xC0,0x07,0xFF,0xE0,0x07,0xFF,0xF0,0x0F,0xE7,0xF0,0x1F,0x81,
+    0xF8,0x1F,0x80,0xF8,0x1F,0x00,0xFC,0x1F,0x00,0xFC,0x1F,0x00,0xFC,0x1F,0x00,0xFC,
+    0x1F,0x00,0xFC,0x1F,0x00,0xFC,0x1F,0x80,0xFC,0x1F,0x81,0xF8,0x1F,0xE7,0xF8,0x0F,
+    0xFF,0xF8,0x0F,0xFF,0xF0,0x07,0xFF,0xF0,0x03,0xFF,0xE0,0x01,0xFF,0xC0,0x00,0x7E,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '8'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0x03,
+    0xFF,0x80,0x07,0xFF,0xC0,0x07,0xFF,0xE0,0x0F,0xFF,0xF0,0x0F,0xFF,0xF0,0x1F,0xC3,
+    0xF0,0x1F,0x81,0xF8,0x1F,0x01,0xF8,0x1F,0x01,0xF8,0x1F,0x01,0xF8,0x3F,0x00,0xFC,
+    0x3F,0x01,0xFC,0x3F,0x00,0xFC,0x3F,0x01,0xFC,0x1F,0x01,0xFC,0x1F,0x81,0xFC,0x1F,
+    0x81,0xFC,0x1F,0xC3,0xFC,0x1F,0xFF,0xFC,0x0F,0xFF,0xFC,0x0F,0xFF,0xFC,0x07,0xFF,
+    0xFC,0x03,0xFE,0xFC,0x01,0xFC,0xFC,0x00,0x70,0xFC,0x00,0x00,0xFC,0x00,0x00,0xF8,
+    0x00,0x01,0xF8,0x00,0x01,0xF8,0x00,0x03,0xF8,0x0C,0x03,0xF0,0x0F,0x0F,0xF0,0x0F,
+    0xFF,0xE0,0x0F,0xFF,0xE0,0x0F,0xFF,0xC0,0x0F,0xFF,0x80,0x0F,0xFF,0x00,0x03,0xFC,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '9'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x7F,0x00,0x00,0x7F,0x00,0x00,0x7F,0x00,
+    0x00,0x7F,0x00,0x00,0x7F,0x00,0x00,0x7F,0x00,0x00,0x7F,0x00,0x00,0x7F,0x00,0x00,
+    0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x00,0x00,0x7F,0x00,
+    0x00,0x7F,0x00,0x00,0x7F,0x00,0x00,0x7F,0x00,0x00,0x7F,0x00,0x00,0x7F,0x00,0x00,
+    0x7F,0x00,0x00,0x7F,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // ':'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,
+    0xFF,0x00,0x01,0xFF,0x00,0x01,0xFF,0x00,0x01,0xFF,0x00,0x01,0xFF,0x00,0x01,0xFF,
+    0x80,0x03,0xFF,0x80,0x03,0xFF,0x80,0x03,0xEF,0x80,0x03,0xEF,0x80,0x03,0xEF,0xC0,
+    0x07,0xEF,0xC0,0x07,0xE7,0xC0,0x07,0xC7,0xC0,0x07,0xC7,0xC0,0x07,0xC7,0xE0,0x0F,
+    0xC7,0xE0,0x0F,0xC7,0xE0,0x0F,0xC3,0xE0,0x0F,0x83,0xE0,0x0F,0x83,0xF0,0x1F,0xFF,
+    0xF0,0x1F,0xFF,0xF0,0x1F,0xFF,0xF0,0x1F,0xFF,0xF0,0x1F,0xFF,0xF8,0x3F,0xFF,0xF8,
+    0x3F,0xFF,0xF8,0x3F,0x01,0xF8,0x3F,0x00,0xFC,0x7E,0x00,0xFC,0x7E,0x00,0xFC,0x7E,
+    0x00,0xFC,0x7E,0x00,0xFC,0x7E,0x00,0x7E,0xFC,0x00,0x7E,0xFC,0x00,0x7E,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'A'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x80,0x00,0x3F,0xF0,0x00,
+    0xFF,0xF8,0x01,0xFF,0xF8,0x03,0xFF,0xF8,0x03,0xFF,0xF8,0x07,0xFF,0xF8,0x07,0xFC,
+    0xF8,0x0F,0xF0,0x38,0x0F,0xE0,0x08,0x0F,0xC0,0x00,0x1F,0xC0,0x00,0x1F,0xC0,0x00,
+    0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,
+    0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,
+    0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0xC0,0x00,0x1F,0xC0,0x00,
+    0x0F,0xC0,0x00,0x0F,0xE0,0x08,0x0F,0xF0,0x18,0x07,0xF8,0x78,0x07,0xFF,0xF8,0x03,
+    0xFF,0xF8,0x03,0xFF,0xF8,0x01,0xFF,0xF8,0x00,0xFF,0xF8,0x00,0x7F,0xF0,0x00,0x0F,
+    0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'C'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0xF8,0x1F,
+    0xFF,0xF8,0x1F,0xFF,0xF8,0x1F,0xFF,0xF8,0x1F,0xFF,0xF8,0x1F,0xFF,0xF8,0x1F,0xFF,
+    0xF8,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,
+    0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0xFF,0xF0,0x1F,0xFF,0xF0,0x1F,
+    0xFF,0xF0,0x1F,0xFF,0xF0,0x1F,0xFF,0xF0,0x1F,0xFF,0xF0,0x1F,0xFF,0xF0,0x1F,0x80,
+    0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,
+    0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0xFF,0xF8,0x1F,0xFF,0xF8,0x1F,
+    0xFF,0xF8,0x1F,0xFF,0xF8,0x1F,0xFF,0xF8,0x1F,0xFF,0xF8,0x1F,0xFF,0xF8,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'E'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFF,0xFC,0x1F,
+    0xFF,0xFC,0x1F,0xFF,0xFC,0x1F,0xFF,0xFC,0x1F,0xFF,0xFC,0x1F,0xFF,0xFC,0x1F,0xFF,
+    0xFC,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,
+    0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0xFF,0xF8,0x1F,0xFF,0xF8,0x1F,
+    0xFF,0xF8,0x1F,0xFF,0xF8,0x1F,0xFF,0xF8,0x1F,0xFF,0xF8,0x1F,0xFF,0xF0,0x1F,0x80,
+    0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,
+    0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,
+    0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'F'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0xF8,0x1F,
+    0xFF,0xF8,0x1F,0xFF,0xF8,0x1F,0xFF,0xF8,0x1F,0xFF,0xF8,0x1F,0xFF,0xF8,0x1F,0xFF,
+    0xF8,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,
+    0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,
+    0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,
+    0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,
+    0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x0F,0xFF,0xF0,0x1F,0xFF,0xF8,0x1F,
+    0xFF,0xF8,0x1F,0xFF,0xF8,0x1F,0xFF,0xF8,0x1F,0xFF,0xF8,0x1F,0xFF,0xF8,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'I'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xC0,0x00,0x0F,
+    0xC0,0x00,0x0F,0xC0,0x00,0x0F,0xC0,0x00,0x0F,0xC0,0x00,0x0F,0xC0,0x00,0x0F,0xC0,
+    0x00,0x0F,0xC0,0x00,0x0F,0xC0,0x00,0x0F,0xC0,0x00,0x0F,0xC0,0x00,0x0F,0xC0,0x00,
+    0x0F,0xC0,0x00,0x0F,0xC0,0x00,0x0F,0xC0,0x00,0x0F,0xC0,0x00,0x0F,0xC0,0x00,0x0F,
+    0xC0,0x00,0x0F,0xC0,0x00,0x0F,0xC0,0x00,0x0F,0xC0,0x00,0x0F,0xC0,0x00,0x0F,0xC0,
+    0x00,0x0F,0xC0,0x00,0x0F,0xC0,0x00,0x0F,0xC0,0x00,0x0F,0xC0,0x00,0x0F,0xC0,0x00,
+    0x0F,0xC0,0x00,0x0F,0xC0,0x00,0x0F,0xC0,0x00,0x0F,0xFF,0xFC,0x0F,0xFF,0xFC,0x0F,
+    0xFF,0xFC,0x0F,0xFF,0xFC,0x0F,0xFF,0xFC,0x0F,0xFF,0xFC,0x0F,0xFF,0xFC,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'L'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x01,0xFC,0x7F,
+    0x81,0xFC,0x7F,0x81,0xFC,0x7F,0x83,0xFC,0x7F,0x83,0xFC,0x7F,0xC3,0xFC,0x7F,0xC3,
+    0xFC,0x7F,0xC3,0xFC,0x7F,0xC7,0xFC,0x7F,0xC7,0xFC,0x7F,0xE7,0xFC,0x7F,0xE7,0x7C,
+    0x7D,0xE7,0x7C,0x7C,0xEF,0x7C,0x7C,0xEF,0x7C,0x7E,0xFF,0x7C,0x7E,0xFF,0x7C,0x7E,
+    0xFE,0x7C,0x7E,0xFE,0x7C,0x7E,0x7E,0x7C,0x7E,0x7E,0x7C,0x7E,0x7E,0x7C,0x7E,0x7C,
+    0x7C,0x7E,0x7C,0x7C,0x7E,0x3C,0x7C,0x7E,0x00,0x7C,0x7E,0x00,0x7C,0x7E,0x00,0x7C,
+    0x7E,0x00,0x7C,0x7E,0x00,0x7C,0x7E,0x00,0x7C,0x7E,0x00,0x7C,0x7E,0x00,0x7C,0x7E,
+    0x00,0x7C,0x7E,0x00,0x7C,0x7E,0x00,0x7C,0x7E,0x00,0x7C,0x7E,0x00,0x7C,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'M'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0xF8,0x3F,
+    0x80,0xFC,0x3F,0x80,0xFC,0x3F,0x80,0xFC,0x3F,0xC0,0xFC,0x3F,0xC0,0xFC,0x3F,0xC0,
+    0xFC,0x3F,0xE0,0xFC,0x3F,0xE0,0xFC,0x3F,0xE0,0xFC,0x3F,0xE0,0xFC,0x3F,0xF0,0xFC,
+    0x3F,0xF0,0xFC,0x3E,0xF0,0xFC,0x3E,0xF8,0xFC,0x3E,0x78,0xFC,0x3E,0x78,0xFC,0x3E,
+    0x7C,0xFC,0x3E,0x7C,0xFC,0x3E,0x3C,0xFC,0x3E,0x3C,0xFC,0x3E,0x3E,0xFC,0x3E,0x1E,
+    0xFC,0x3E,0x1E,0xFC,0x3E,0x1E,0xFC,0x3E,0x0F,0xFC,0x3E,0x0F,0xFC,0x3E,0x0F,0xFC,
+    0x3E,0x0F,0xFC,0x3E,0x07,0xFC,0x3E,0x07,0xFC,0x3E,0x07,0xFC,0x3E,0x07,0xFC,0x3E,
+    0x03,0xFC,0x3E,0x03,0xFC,0x3E,0x03,0xFC,0x3E,0x01,0xFC,0x3E,0x01,0xFC,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'N'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0xFF,0x00,0x03,
+    0xFF,0xC0,0x07,0xFF,0xC0,0x07,0xFF,0xE0,0x0F,0xFF,0xF0,0x0F,0xFF,0xF0,0x1F,0xE7,
+    0xF8,0x1F,0xC3,0xF8,0x1F,0x81,0xF8,0x1F,0x81,0xFC,0x3F,0x01,0xFC,0x3F,0x00,0xFC,
+    0x3F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,
+    0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,
+    0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xFC,
+    0x3F,0x81,0xFC,0x1F,0x81,0xF8,0x1F,0xC3,0xF8,0x1F,0xE7,0xF8,0x0F,0xFF,0xF0,0x0F,
+    0xFF,0xF0,0x07,0xFF,0xE0,0x07,0xFF,0xE0,0x03,0xFF,0xC0,0x01,0xFF,0x80,0x00,0x7E,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'O'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xFE,0x00,0x1F,
+    0xFF,0xC0,0x1F,0xFF,0xE0,0x1F,0xFF,0xF0,0x1F,0xFF,0xF8,0x1F,0xFF,0xF8,0x1F,0xFF,
+    0xFC,0x1F,0x81,0xFC,0x1F,0x81,0xFC,0x1F,0x80,0xFC,0x1F,0x80,0xFC,0x1F,0x80,0xFC,
+    0x1F,0x80,0xFC,0x1F,0x80,0xFC,0x1F,0x80,0xFC,0x1F,0x81,0xFC,0x1F,0x81,0xFC,0x1F,
+    0xFF,0xFC,0x1F,0xFF,0xF8,0x1F,0xFF,0xF8,0x1F,0xFF,0xF0,0x1F,0xFF,0xE0,0x1F,0xFF,
+    0xC0,0x1F,0xFE,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,
+    0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,
+    0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'P'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xFE,0x00,0x3F,
+    0xFF,0x80,0x3F,0xFF,0xE0,0x3F,0xFF,0xF0,0x3F,0xFF,0xF0,0x3F,0xFF,0xF8,0x3F,0xFF,
+    0xF8,0x3F,0x03,0xF8,0x3F,0x01,0xF8,0x3F,0x01,0xF8,0x3F,0x01,0xF8,0x3F,0x01,0xF8,
+    0x3F,0x01,0xF8,0x3F,0x01,0xF8,0x3F,0x01,0xF8,0x3F,0x03,0xF8,0x3F,0x8F,0xF0,0x3F,
+    0xFF,0xF0,0x3F,0xFF,0xE0,0x3F,0xFF,0xC0,0x3F,0xFF,0x00,0x3F,0xFF,0x80,0x3F,0xFF,
+    0xC0,0x3F,0x1F,0xC0,0x3F,0x0F,0xE0,0x3F,0x07,0xE0,0x3F,0x07,0xE0,0x3F,0x03,0xF0,
+    0x3F,0x03,0xF0,0x3F,0x03,0xF8,0x3F,0x01,0xF8,0x3F,0x01,0xF8,0x3F,0x01,0xFC,0x3F,
+    0x00,0xFC,0x3F,0x00,0xFE,0x3F,0x00,0xFE,0x3F,0x00,0x7E,0x3F,0x00,0x7F,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'R'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x01,0xFF,0x80,0x03,
+    0xFF,0xE0,0x07,0xFF,0xF0,0x0F,0xFF,0xF0,0x1F,0xFF,0xF0,0x1F,0xFF,0xF0,0x1F,0x80,
+    0xF0,0x3F,0x80,0x70,0x3F,0x00,0x10,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,
+    0x3F,0x80,0x00,0x3F,0xC0,0x00,0x1F,0xF0,0x00,0x1F,0xFC,0x00,0x0F,0xFF,0x00,0x0F,
+    0xFF,0x80,0x07,0xFF,0xC0,0x03,0xFF,0xE0,0x00,0xFF,0xF0,0x00,0x7F,0xF0,0x00,0x1F,
+    0xF8,0x00,0x07,0xF8,0x00,0x03,0xF8,0x00,0x01,0xFC,0x00,0x01,0xFC,0x00,0x00,0xFC,
+    0x00,0x00,0xFC,0x30,0x01,0xFC,0x38,0x01,0xF8,0x3E,0x03,0xF8,0x3F,0xFF,0xF8,0x3F,
+    0xFF,0xF8,0x3F,0xFF,0xF0,0x3F,0xFF,0xE0,0x1F,0xFF,0xC0,0x07,0xFF,0x80,0x01,0xFE,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'S'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xFF,0xFC,0x3F,
+    0xFF,0xFC,0x3F,0xFF,0xFC,0x3F,0xFF,0xFC,0x3F,0xFF,0xFC,0x3F,0xFF,0xFC,0x3F,0xFF,
+    0xFC,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,
+    0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,
+    0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,
+    0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,
+    0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,
+    0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'T'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x7E,0x7E,
+    0x00,0x7E,0x7E,0x00,0x7E,0x3F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,
+    0xFC,0x3F,0x00,0xFC,0x1F,0x00,0xFC,0x1F,0x80,0xF8,0x1F,0x81,0xF8,0x1F,0x81,0xF8,
+    0x1F,0x81,0xF8,0x1F,0x81,0xF8,0x0F,0x81,0xF0,0x0F,0xC1,0xF0,0x0F,0xC3,0xF0,0x0F,
+    0xC3,0xF0,0x0F,0xC3,0xF0,0x07,0xC3,0xF0,0x07,0xC3,0xE0,0x07,0xE3,0xE0,0x07,0xE7,
+    0xE0,0x07,0xE7,0xE0,0x03,0xE7,0xE0,0x03,0xE7,0xC0,0x03,0xE7,0xC0,0x03,0xE7,0xC0,
+    0x03,0xF7,0xC0,0x03,0xFF,0xC0,0x01,0xFF,0x80,0x01,0xFF,0x80,0x01,0xFF,0x80,0x01,
+    0xFF,0x80,0x01,0xFF,0x80,0x01,0xFF,0x80,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'V'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xFF,0x00,0x07,0xFF,0xC0,0x0F,0xFF,0xE0,
+    0x0F,0xFF,0xF0,0x0F,0xFF,0xF0,0x0F,0xFF,0xF8,0x0E,0x01,0xF8,0x18,0x01,0xF8,0x00,
+    0x00,0xF8,0x00,0x00,0xF8,0x00,0xFF,0xF8,0x07,0xFF,0xF8,0x0F,0xFF,0xF8,0x1F,0xFF,
+    0xF8,0x1F,0xFF,0xF8,0x3F,0xFF,0xF8,0x3F,0xC0,0xF8,0x3F,0x00,0xF8,0x7F,0x01,0xF8,
+    0x7F,0x01,0xF8,0x7F,0x01,0xF8,0x7F,0x01,0xF8,0x3F,0x03,0xF8,0x3F,0x87,0xF8,0x3F,
+    0xCF,0xF8,0x3F,0xFF,0xF8,0x1F,0xFF,0xF8,0x0F,0xFC,0xF8,0x07,0xFC,0xF8,0x01,0xF0,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'a'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x1F,0x00,0x00,0x1F,
+    0x00,0x00,0x1F,0x00,0x00,0x1F,0x00,0x00,0x1F,0x00,0x00,0x1F,0x00,0x00,0x1F,0x00,
+    0x00,0x1F,0x00,0x00,0x1F,0x00,0x00,0x1F,0x0F,0x80,0x1F,0x3F,0xC0,0x1F,0x3F,0xE0,
+    0x1F,0x7F,0xF0,0x1F,0xFF,0xF0,0x1F,0xFF,0xF8,0x1F,0xE7,0xF8,0x1F,0xC1,0xF8,0x1F,
+    0xC1,0xFC,0x1F,0x80,0xFC,0x1F,0x80,0xFC,0x1F,0x80,0xFC,0x1F,0x80,0xFC,0x1F,0x00,
+    0xFC,0x1F,0x00,0xFC,0x1F,0x00,0xFC,0x1F,0x00,0xFC,0x1F,0x80,0xFC,0x1F,0x80,0xFC,
+    0x1F,0x80,0xFC,0x1F,0x80,0xFC,0x1F,0xC1,0xFC,0x1F,0xC1,0xF8,0x1F,0xE7,0xF8,0x1F,
+    0xFF,0xF8,0x1F,0xFF,0xF0,0x1F,0x7F,0xF0,0x1F,0x3F,0xE0,0x1F,0x3F,0xC0,0x00,0x0F,
+    0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'b'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x80,0x00,0xFF,0xE0,0x01,0xFF,0xF0,
+    0x03,0xFF,0xF0,0x07,0xFF,0xF0,0x07,0xFF,0xF0,0x0F,0xF0,0x70,0x0F,0xE0,0x38,0x0F,
+    0xC0,0x00,0x1F,0xC0,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,
+    0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,
+    0x1F,0x80,0x00,0x1F,0xC0,0x00,0x0F,0xC0,0x10,0x0F,0xE0,0x30,0x0F,0xF8,0xF0,0x07,
+    0xFF,0xF0,0x07,0xFF,0xF0,0x03,0xFF,0xF0,0x01,0xFF,0xF0,0x00,0xFF,0xE0,0x00,0x3F,
+    0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'c'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xF8,0x00,0x01,0xF8,0x00,
+    0x01,0xF8,0x00,0x01,0xF8,0x00,0x01,0xF8,0x00,0x01,0xF8,0x00,0x01,0xF8,0x00,0x01,
+    0xF8,0x00,0x01,0xF8,0x00,0x01,0xF8,0x01,0xF1,0xF8,0x07,0xF9,0xF8,0x0F,0xFD,0xF8,
+    0x0F,0xFF,0xF8,0x1F,0xFF,0xF8,0x1F,0xFF,0xF8,0x3F,0xCF,0xF8,0x3F,0x87,0xF8,0x3F,
+    0x03,0xF8,0x3F,0x03,0xF8,0x3F,0x01,0xF8,0x3F,0x01,0xF8,0x7E,0x01,0xF8,0x7E,0x01,
+    0xF8,0x7E,0x01,0xF8,0x7E,0x01,0xF8,0x7E,0x01,0xF8,0x7E,0x01,0xF8,0x3F,0x01,0xF8,
+    0x3F,0x01,0xF8,0x3F,0x03,0xF8,0x3F,0x03,0xF8,0x3F,0x87,0xF8,0x1F,0xCF,0xF8,0x1F,
+    0xFF,0xF8,0x1F,0xFF,0xF8,0x0F,0xFF,0xF8,0x07,0xFD,0xF8,0x07,0xF9,0xF8,0x01,0xF0,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'd'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x00,0x01,0xFF,0xC0,0x03,0xFF,0xE0,
+    0x07,0xFF,0xF0,0x0F,0xFF,0xF0,0x0F,0xFF,0xF8,0x1F,0xC3,0xF8,0x1F,0x81,0xFC,0x3F,
+    0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0xFF,0xFC,0x3F,0xFF,0xFE,0x3F,0xFF,
+    0xFE,0x3F,0xFF,0xFE,0x3F,0xFF,0xFE,0x3F,0xFF,0xFE,0x3F,0x00,0x00,0x3F,0x00,0x00,
+    0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x80,0x0C,0x1F,0x80,0x1C,0x1F,0xE0,0xFC,0x0F,
+    0xFF,0xFC,0x0F,0xFF,0xFC,0x07,0xFF,0xFC,0x03,0xFF,0xFC,0x01,0xFF,0xF0,0x00,0x7F,
+    0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'e'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xF8,0x00,0x03,0xFC,0xF8,0x07,0xFE,0xF8,
+    0x0F,0xFF,0xF8,0x1F,0xFF,0xF8,0x1F,0xEF,0xF8,0x3F,0x83,0xF8,0x3F,0x83,0xF8,0x3F,
+    0x01,0xF8,0x3F,0x01,0xF8,0x3F,0x01,0xF8,0x3F,0x01,0xF8,0x3F,0x01,0xF8,0x3E,0x00,
+    0xF8,0x3F,0x01,0xF8,0x3F,0x01,0xF8,0x3F,0x01,0xF8,0x3F,0x01,0xF8,0x3F,0x83,0xF8,
+    0x1F,0xC7,0xF8,0x1F,0xFF,0xF8,0x0F,0xFF,0xF8,0x0F,0xFF,0xF8,0x07,0xFC,0xF8,0x01,
+    0xF8,0xF8,0x00,0x01,0xF8,0x00,0x01,0xF8,0x00,0x01,0xF8,0x0C,0x03,0xF8,0x0F,0xFF,
+    0xF8,0x0F,0xFF,0xF0,0x0F,0xFF,0xF0,0x0F,0xFF,0xE0,0x0F,0xFF,0x80,0x03,0xFE,0x00,  // 'g'
+    0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,
+    0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFF,0x00,0x0F,0xFF,0x00,
+    0x0F,0xFF,0x00,0x0F,0xFF,0x00,0x0F,0xFF,0x00,0x07,0xFF,0x00,0x00,0x3F,0x00,0x00,
+    0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,
+    0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,
+    0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x1F,0xFF,0xFC,0x1F,
+    0xFF,0xFE,0x1F,0xFF,0xFE,0x1F,0xFF,0xFE,0x1F,0xFF,0xFE,0x1F,0xFF,0xFE,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'i'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,
+    0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,
+    0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x81,0xFC,0x1F,0x83,0xFC,
+    0x1F,0x83,0xF8,0x1F,0x87,0xF0,0x1F,0x8F,0xE0,0x1F,0x8F,0xC0,0x1F,0x9F,0xC0,0x1F,
+    0xBF,0x80,0x1F,0xFF,0x00,0x1F,0xFE,0x00,0x1F,0xFE,0x00,0x1F,0xFE,0x00,0x1F,0xFF,
+    0x00,0x1F,0xFF,0x00,0x1F,0xFF,0x80,0x1F,0xDF,0x80,0x1F,0xCF,0xC0,0x1F,0x8F,0xC0,
+    0x1F,0x8F,0xE0,0x1F,0x87,0xE0,0x1F,0x87,0xF0,0x1F,0x83,0xF0,0x1F,0x83,0xF8,0x1F,
+    0x81,0xF8,0x1F,0x81,0xFC,0x1F,0x80,0xFC,0x1F,0x80,0xFE,0x1F,0x80,0x7E,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'k'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xF8,0x00,0x7F,0xF8,0x00,0x7F,
+    0xF8,0x00,0x7F,0xF8,0x00,0x7F,0xF8,0x00,0x01,0xF8,0x00,0x01,0xF8,0x00,0x01,0xF8,
+    0x00,0x01,0xF8,0x00,0x01,0xF8,0x00,0x01,0xF8,0x00,0x01,0xF8,0x00,0x01,0xF8,0x00,
+    0x01,0xF8,0x00,0x01,0xF8,0x00,0x01,0xF8,0x00,0x01,0xF8,0x00,0x01,0xF8,0x00,0x01,
+    0xF8,0x00,0x01,0xF8,0x00,0x01,0xF8,0x00,0x01,0xF8,0x00,0x01,0xF8,0x00,0x01,0xF8,
+    0x00,0x01,0xF8,0x00,0x01,0xF8,0x00,0x01,0xF8,0x00,0x01,0xF8,0x00,0x01,0xF8,0x00,
+    0x01,0xF8,0x00,0x01,0xF8,0x00,0x01,0xFC,0x00,0x00,0xFC,0x00,0x00,0xFF,0xF8,0x00,
+    0xFF,0xF8,0x00,0x7F,0xF8,0x00,0x7F,0xF8,0x00,0x3F,0xF8,0x00,0x1F,0xF8,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'l'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF1,0xF0,0x7D,0xFB,0xF8,0x7F,0xFB,0xF8,
+    0x7F,0xFF,0xFC,0x7F,0xFF,0xFC,0x7F,0xFF,0xFC,0x7E,0x7E,0x7C,0x7E,0x7E,0x7C,0x7C,
+    0x7C,0x3C,0x7C,0x3C,0x3E,0x7C,0x7C,0x3E,0x7C,0x7C,0x3E,0x7C,0x7C,0x3E,0x7C,0x7C,
+    0x3E,0x7C,0x7C,0x3E,0x7C,0x7C,0x3E,0x7C,0x7C,0x3E,0x7C,0x7C,0x3E,0x7C,0x7C,0x3E,
+    0x7C,0x7C,0x3E,0x7C,0x7C,0x3E,0x7C,0x7C,0x3E,0x7C,0x7C,0x3E,0x7C,0x7C,0x3E,0x7C,
+    0x7C,0x3E,0x7C,0x7C,0x3E,0x7C,0x7C,0x3E,0x7C,0x7C,0x3E,0x7C,0x3C,0x3C,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'm'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x80,0x1F,0x9F,0xC0,0x1F,0xBF,0xE0,
+    0x1F,0xFF,0xF0,0x1F,0xFF,0xF0,0x1F,0xFF,0xF0,0x1F,0xE3,0xF8,0x1F,0xC3,0xF8,0x1F,
+    0xC1,0xF8,0x1F,0x81,0xF8,0x1F,0x81,0xF8,0x1F,0x81,0xF8,0x1F,0x81,0xF8,0x1F,0x81,
+    0xF8,0x1F,0x81,0xF8,0x1F,0x81,0xF8,0x1F,0x81,0xF8,0x1F,0x81,0xF8,0x1F,0x81,0xF8,
+    0x1F,0x81,0xF8,0x1F,0x81,0xF8,0x1F,0x81,0xF8,0x1F,0x81,0xF8,0x1F,0x81,0xF8,0x1F,
+    0x81,0xF8,0x1F,0x81,0xF8,0x1F,0x81,0xF8,0x1F,0x81,0xF8,0x1F,0x81,0xF8,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'n'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x01,0xFF,0x80,0x03,0xFF,0xC0,
+    0x07,0xFF,0xE0,0x0F,0xFF,0xF0,0x0F,0xFF,0xF0,0x1F,0xC7,0xF8,0x1F,0x83,0xF8,0x3F,
+    0x81,0xF8,0x3F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xFC,0x3E,0x00,
+    0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xFC,
+    0x3F,0x00,0xFC,0x3F,0x01,0xFC,0x3F,0x81,0xF8,0x1F,0x83,0xF8,0x1F,0xE7,0xF8,0x0F,
+    0xFF,0xF0,0x0F,0xFF,0xF0,0x07,0xFF,0xE0,0x03,0xFF,0xC0,0x01,0xFF,0x80,0x00,0x7E,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'o'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x80,0x1F,0xBF,0xE0,0x1F,0x3F,0xF0,
+    0x1F,0xFF,0xF0,0x1F,0xFF,0xF8,0x1F,0xF7,0xF8,0x1F,0xC1,0xFC,0x1F,0xC1,0xFC,0x1F,
+    0x80,0xFC,0x1F,0x80,0xFC,0x1F,0x80,0xFC,0x1F,0x80,0xFC,0x1F,0x80,0xFC,0x1F,0x80,
+    0xFC,0x1F,0x80,0xFC,0x1F,0x80,0xFC,0x1F,0x80,0xFC,0x1F,0x80,0xFC,0x1F,0xC1,0xFC,
+    0x1F,0xC1,0xFC,0x1F,0xFF,0xF8,0x1F,0xFF,0xF8,0x1F,0xFF,0xF0,0x1F,0x3F,0xF0,0x1F,
+    0xBF,0xE0,0x1F,0x9F,0x80,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,
+    0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,  // 'p'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xF8,0x07,0xE7,0xFC,0x07,0xE7,0xFC,
+    0x07,0xEF,0xFC,0x07,0xFF,0xFC,0x07,0xFF,0xFC,0x07,0xFF,0xFC,0x07,0xFC,0x06,0x07,
+    0xF8,0x00,0x07,0xF0,0x00,0x07,0xF0,0x00,0x07,0xE0,0x00,0x07,0xE0,0x00,0x07,0xE0,
+    0x00,0x07,0xE0,0x00,0x07,0xE0,0x00,0x07,0xE0,0x00,0x07,0xE0,0x00,0x07,0xE0,0x00,
+    0x07,0xE0,0x00,0x07,0xE0,0x00,0x07,0xE0,0x00,0x07,0xE0,0x00,0x07,0xE0,0x00,0x07,
+    0xE0,0x00,0x07,0xE0,0x00,0x07,0xE0,0x00,0x07,0xE0,0x00,0x07,0xE0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'r'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x80,0x03,0xFF,0xE0,0x07,0xFF,0xE0,
+    0x0F,0xFF,0xE0,0x0F,0xFF,0xE0,0x1F,0xFF,0xE0,0x1F,0x80,0x60,0x1F,0x80,0x20,0x1F,
+    0x80,0x00,0x1F,0x80,0x00,0x1F,0xE0,0x00,0x1F,0xF8,0x00,0x0F,0xFF,0x00,0x0F,0xFF,
+    0xC0,0x07,0xFF,0xE0,0x03,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0x3F,0xF0,0x00,0x07,0xF8,
+    0x00,0x01,0xF8,0x00,0x01,0xF8,0x00,0x01,0xF8,0x18,0x01,0xF8,0x1E,0x03,0xF8,0x1F,
+    0xFF,0xF0,0x1F,0xFF,0xF0,0x1F,0xFF,0xF0,0x1F,0xFF,0xE0,0x0F,0xFF,0xC0,0x01,0xFE,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 's'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x01,0xF8,0x00,0x01,0xF8,0x00,0x01,0xF8,0x00,0x01,0xF8,0x00,0x01,0xF8,
+    0x00,0x01,0xF8,0x00,0x01,0xF8,0x00,0x01,0xFC,0x00,0x3F,0xFF,0xF8,0x3F,0xFF,0xF8,
+    0x3F,0xFF,0xF8,0x3F,0xFF,0xF8,0x3F,0xFF,0xF8,0x1F,0xFF,0xF0,0x01,0xF8,0x00,0x01,
+    0xF8,0x00,0x01,0xF8,0x00,0x01,0xF8,0x00,0x01,0xF8,0x00,0x01,0xF8,0x00,0x01,0xF8,
+    0x00,0x01,0xF8,0x00,0x01,0xF8,0x00,0x01,0xF8,0x00,0x01,0xF8,0x00,0x01,0xF8,0x00,
+    0x01,0xF8,0x00,0x01,0xF8,0x00,0x01,0xF8,0x00,0x00,0xFC,0x00,0x00,0xFF,0xF0,0x00,
+    0xFF,0xF8,0x00,0xFF,0xF8,0x00,0x7F,0xF8,0x00,0x3F,0xF8,0x00,0x1F,0xF8,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 't'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x81,0xF8,0x1F,0x81,0xF8,
+    0x1F,0x81,0xF8,0x1F,0x81,0xF8,0x1F,0x81,0xF8,0x1F,0x81,0xF8,0x1F,0x81,0xF8,0x1F,
+    0x81,0xF8,0x1F,0x81,0xF8,0x1F,0x81,0xF8,0x1F,0x81,0xF8,0x1F,0x81,0xF8,0x1F,0x81,
+    0xF8,0x1F,0x81,0xF8,0x1F,0x81,0xF8,0x1F,0x81,0xF8,0x1F,0x81,0xF8,0x1F,0x81,0xF8,
+    0x1F,0x81,0xF8,0x1F,0x81,0xF8,0x1F,0x81,0xF8,0x1F,0xC3,0xF8,0x1F,0xE7,0xF8,0x0F,
+    0xFF,0xF8,0x0F,0xFF,0xF8,0x0F,0xFF,0xF8,0x07,0xFD,0xF8,0x03,0xF9,0xF8,0x01,0xF0,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'u'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0xFE,0x3F,0x00,0xFC,
+    0x3F,0x00,0xFC,0x3F,0x00,0xFC,0x1F,0x00,0xFC,0x1F,0x81,0xF8,0x1F,0x81,0xF8,0x1F,
+    0x81,0xF8,0x0F,0x81,0xF0,0x0F,0xC1,0xF0,0x0F,0xC3,0xF0,0x0F,0xC3,0xF0,0x07,0xC3,
+    0xF0,0x07,0xC3,0xE0,0x07,0xE7,0xE0,0x07,0xE7,0xE0,0x03,0xE7,0xE0,0x03,0xE7,0xC0,
+    0x03,0xE7,0xC0,0x03,0xF7,0xC0,0x01,0xFF,0xC0,0x01,0xFF,0x80,0x01,0xFF,0x80,0x01,
+    0xFF,0x80,0x01,0xFF,0x80,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'v'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x81,0xFC,0x1F,0x81,0xFC,
+    0x1F,0xC1,0xF8,0x0F,0xC3,0xF8,0x0F,0xE3,0xF0,0x07,0xE7,0xF0,0x07,0xE7,0xE0,0x03,
+    0xFF,0xC0,0x03,0xFF,0xC0,0x01,0xFF,0x80,0x00,0xFF,0x80,0x00,0xFF,0x00,0x00,0x7F,
+    0x00,0x00,0x7E,0x00,0x00,0x7F,0x00,0x00,0xFF,0x00,0x01,0xFF,0x80,0x01,0xFF,0xC0,
+    0x03,0xFF,0xC0,0x03,0xF7,0xE0,0x07,0xE7,0xE0,0x07,0xE7,0xF0,0x0F,0xC3,0xF0,0x0F,
+    0xC3,0xF8,0x1F,0xC1,0xF8,0x3F,0x81,0xFC,0x3F,0x80,0xFC,0x7F,0x00,0xFE,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'x'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x7E,0x3F,0x00,0xFE,
+    0x3F,0x00,0xFC,0x3F,0x00,0xFC,0x1F,0x81,0xFC,0x1F,0x81,0xF8,0x1F,0x81,0xF8,0x0F,
+    0xC1,0xF0,0x0F,0xC3,0xF0,0x0F,0xC3,0xF0,0x07,0xE3,0xE0,0x07,0xE7,0xE0,0x07,0xE7,
+    0xE0,0x03,0xE7,0xE0,0x03,0xF7,0xC0,0x03,0xFF,0xC0,0x01,0xFF,0xC0,0x01,0xFF,0x80,
+    0x00,0xFF,0x80,0x00,0xFF,0x80,0x00,0xFF,0x00,0x00,0x7F,0x00,0x00,0x7F,0x00,0x00,
+    0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0xFC,0x00,0x00,0xFC,0x00,0x01,0xFC,
+    0x00,0x3F,0xF8,0x00,0x3F,0xF8,0x00,0x3F,0xF0,0x00,0x3F,0xE0,0x00,0x3F,0x80,0x00,  // 'y'
+};
+
+sFONT Font48 = { Font48_Table, 24, 48, Font48_Map };
+
+static const uint8_t fontAA24Table[] = {
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // ' '
+    0x00,0x00,0x00,0x00,0x28,0x00,0x01,0xFF,0x80,0x07,0xFF,0xD0,0x0B,0xFF,0xF0,0x0F,
+    0xD3,0xF4,0x1F,0x82,0xF8,0x2F,0x83,0xF8,0x2F,0x8B,0xFC,0x2F,0x8F,0xFC,0x2F,0x9D,
+    0xFC,0x2F,0xA8,0xFC,0x2F,0x74,0xFC,0x2F,0xF0,0xFC,0x2F,0xE0,0xFC,0x2F,0xC2,0xF8,
+    0x2F,0x82,0xF8,0x0F,0xC3,0xF4,0x0B,0xFF,0xF0,0x07,0xFF,0xE0,0x01,0xFF,0x80,0x00,
+    0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '0'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xBF,0x00,0x0F,0xFF,0x00,0x0F,0xFF,0x00,0x0F,
+    0xBF,0x00,0x08,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,
+    0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,
+    0x00,0x3F,0x00,0x0A,0xBF,0xA8,0x0F,0xFF,0xFE,0x0F,0xFF,0xFE,0x0F,0xFF,0xFD,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '1'
+    0x00,0x00,0x00,0x00,0x64,0x00,0x1B,0xFF,0x80,0x2F,0xFF,0xE0,0x2F,0xEF,0xF0,0x28,
+    0x03,0xF8,0x00,0x02,0xF8,0x00,0x02,0xF8,0x00,0x02,0xF8,0x00,0x03,0xF0,0x00,0x0B,
+    0xE0,0x00,0x1F,0xC0,0x00,0x3F,0x40,0x00,0xBE,0x00,0x01,0xF8,0x00,0x07,0xF4,0x00,
+    0x0B,0xD0,0x00,0x2F,0xAA,0xA4,0x3F,0xFF,0xF8,0x3F,0xFF,0xF8,0x3F,0xFF,0xF8,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '2'
+    0x00,0x00,0x00,0x00,0x68,0x00,0x0B,0xFF,0x80,0x2F,0xFF,0xE0,0x2F,0xFF,0xF0,0x19,
+    0x06,0xF8,0x00,0x02,0xF8,0x00,0x02,0xF8,0x00,0x02,0xF4,0x00,0xFF,0xE0,0x00,0xFF,
+    0x80,0x00,0xFF,0xD0,0x00,0xAB,0xF0,0x00,0x02,0xF8,0x00,0x00,0xFC,0x00,0x00,0xFC,
+    0x00,0x00,0xFC,0x28,0x02,0xF8,0x2F,0xFF,0xF8,0x2F,0xFF,0xE0,0x1F,0xFF,0x80,0x01,
+    0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '3'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0xE0,0x00,0x0F,0xF0,0x00,0x2F,0xF0,0x00,
+    0x3F,0xF0,0x00,0xBF,0xF0,0x00,0xF7,0xF0,0x02,0xF3,0xF0,0x03,0xE3,0xF0,0x0B,0xC3,
+    0xF0,0x0F,0x83,0xF0,0x2F,0x03,0xF0,0x3E,0xAB,0xE8,0x3F,0xFF,0xFE,0x3F,0xFF,0xFE,
+    0x3F,0xFF,0xFD,0x00,0x03,0xE0,0x00,0x03,0xF0,0x00,0x03,0xF0,0x00,0x03,0xE0,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '4'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFF,0xF0,0x0F,0xFF,0xF0,0x0F,0xFF,0xF0,0x0F,
+    0xAA,0xA0,0x0F,0x80,0x00,0x0F,0x80,0x00,0x0F,0xA9,0x00,0x0F,0xFF,0x80,0x0F,0xFF,
+    0xE0,0x0F,0xAF,0xF4,0x08,0x02,0xF8,0x00,0x01,0xFC,0x00,0x00,0xFC,0x00,0x00,0xFC,
+    0x00,0x01,0xFC,0x18,0x06,0xF8,0x2F,0xFF,0xF4,0x2F,0xFF,0xE0,0x1F,0xFF,0x80,0x01,
+    0xA8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '5'
+    0x00,0x00,0x00,0x00,0x06,0x00,0x00,0xBF,0xE0,0x02,0xFF,0xF0,0x07,0xFF,0xF0,0x0B,
+    0xE0,0x20,0x0F,0xC0,0x00,0x2F,0x80,0x00,0x2F,0x9A,0x40,0x2F,0x7F,0xE0,0x2F,0xFF,
+    0xF4,0x2F,0xFB,0xF8,0x2F,0xC1,0xFC,0x2F,0x80,0xFC,0x2F,0x80,0xBC,0x2F,0x80,0xBC,
+    0x1F,0x80,0xFC,0x0F,0xC1,0xFC,0x0B,0xFB,0xF8,0x07,0xFF,0xF0,0x01,0xFF,0xD0,0x00,
+    0x2A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '6'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x2F,0xFF,0xF8,0x2F,0xFF,0xF8,0x2F,0xFF,0xF8,0x1A,
+    0xAA,0xF8,0x00,0x03,0xF0,0x00,0x07,0xF0,0x00,0x0B,0xE0,0x00,0x0B,0xD0,0x00,0x0F,
+    0xC0,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x3F,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,
+    0x00,0xFC,0x00,0x01,0xF8,0x00,0x02,0xF8,0x00,0x03,0xF4,0x00,0x03,0xF0,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '7'
+    0x00,0x00,0x00,0x00,0x28,0x00,0x02,0xFF,0x80,0x0B,0xFF,0xE0,0x0F,0xFF,0xF0,0x1F,
+    0x82,0xF8,0x2F,0x80,0xF8,0x2F,0x80,0xF8,0x0F,0x82,0xF4,0x0B,0xEB,0xF0,0x02,0xFF,
+    0x90,0x06,0xFF,0xD0,0x0B,0xEB,0xF0,0x2F,0x81,0xF8,0x2F,0x00,0xFC,0x2F,0x00,0xFC,
+    0x2F,0x00,0xFC,0x2F,0x81,0xF8,0x1F,0xEB,0xF8,0x0B,0xFF,0xF0,0x02,0xFF,0xD0,0x00,
+    0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '8'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0x40,0x0B,0xFF,0xD0,0x0F,0xFF,0xF0,0x2F,
+    0x82,0xF4,0x2F,0x02,0xF8,0x2F,0x01,0xF8,0x3F,0x01,0xFC,0x2F,0x02,0xFC,0x2F,0x82,
+    0xFC,0x2F,0xEB,0xFC,0x0F,0xFF,0xFC,0x07,0xFE,0xFC,0x01,0xB8,0xFC,0x00,0x00,0xF8,
+    0x00,0x02,0xF8,0x08,0x03,0xF4,0x0F,0xAF,0xE0,0x0F,0xFF,0xD0,0x0F,0xFF,0x40,0x02,
+    0xA8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '9'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x7E,0x00,0x00,0xBF,0x00,0x00,0xBF,0x00,0x00,0xBF,0x00,0x00,0xBF,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0x00,
+    0x00,0xBF,0x00,0x00,0xBF,0x00,0x00,0xBF,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // ':'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x02,0xFF,0x00,0x02,0xFF,0x00,0x02,
+    0xFF,0x80,0x03,0xEF,0x80,0x03,0xEF,0x80,0x0B,0xEB,0xC0,0x0B,0xCB,0xC0,0x0B,0xCB,
+    0xE0,0x0F,0xC7,0xE0,0x0F,0x83,0xE0,0x2F,0xFF,0xF0,0x2F,0xFF,0xF0,0x2F,0xFF,0xF8,
+    0x3F,0xAA,0xF8,0x7E,0x00,0xFC,0xBE,0x00,0xFC,0xBE,0x00,0xBD,0xFC,0x00,0xBE,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'A'
+    0x00,0x00,0x00,0x00,0x06,0x40,0x00,0xBF,0xF4,0x02,0xFF,0xF8,0x07,0xFF,0xF8,0x0B,
+    0xF8,0xB8,0x0F,0xD0,0x04,0x2F,0xC0,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,
+    0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0xC0,0x00,
+    0x0F,0xD0,0x04,0x0B,0xF4,0x68,0x07,0xFF,0xF8,0x02,0xFF,0xF8,0x00,0xBF,0xF4,0x00,
+    0x0A,0x80,0x00,0x00,0x00,0x00,0x00,0x00,  // 'C'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x2F,0xFF,0xF8,0x2F,0xFF,0xF8,0x2F,0xFF,0xF8,0x2F,
+    0xAA,0xA4,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0xAA,0xA0,0x2F,0xFF,
+    0xF0,0x2F,0xFF,0xF0,0x2F,0xFF,0xF0,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,
+    0x2F,0x80,0x00,0x2F,0xAA,0xA4,0x2F,0xFF,0xF8,0x2F,0xFF,0xF8,0x2F,0xFF,0xF8,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'E'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0xFC,0x2F,0xFF,0xFC,0x2F,0xFF,0xFC,0x2F,
+    0xAA,0xA8,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0xAA,0xA4,0x2F,0xFF,
+    0xF8,0x2F,0xFF,0xF8,0x2F,0xFF,0xF4,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,
+    0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'F'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x2F,0xFF,0xF8,0x2F,0xFF,0xF8,0x2F,0xFF,0xF8,0x1A,
+    0xBE,0xA4,0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,
+    0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,
+    0x00,0xBE,0x00,0x0A,0xBE,0xA0,0x2F,0xFF,0xF8,0x2F,0xFF,0xF8,0x2F,0xFF,0xF8,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'I'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xC0,0x00,0x0F,0xC0,0x00,0x0F,0xC0,0x00,0x0F,
+    0xC0,0x00,0x0F,0xC0,0x00,0x0F,0xC0,0x00,0x0F,0xC0,0x00,0x0F,0xC0,0x00,0x0F,0xC0,
+    0x00,0x0F,0xC0,0x00,0x0F,0xC0,0x00,0x0F,0xC0,0x00,0x0F,0xC0,0x00,0x0F,0xC0,0x00,
+    0x0F,0xC0,0x00,0x0F,0xEA,0xA8,0x0F,0xFF,0xFC,0x0F,0xFF,0xFC,0x0F,0xFF,0xFC,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'L'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x42,0xFC,0xBF,0x82,0xFC,0xBF,0x83,0xFC,0xBF,
+    0xC3,0xFC,0xBF,0xCB,0xFC,0xBF,0xEB,0xBC,0xBD,0xEB,0xBC,0xBD,0xEF,0xBC,0xBE,0xFE,
+    0xBC,0xBE,0xBE,0xBC,0xBE,0xBE,0xBC,0xBE,0xBC,0xBC,0xBE,0x28,0xBC,0xBE,0x00,0xBC,
+    0xBE,0x00,0xBC,0xBE,0x00,0xBC,0xBE,0x00,0xBC,0xBE,0x00,0xBC,0xBE,0x00,0xBC,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'M'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x40,0xF8,0x3F,0x80,0xFC,0x3F,0xC0,0xFC,0x3F,
+    0xD0,0xFC,0x3F,0xE0,0xFC,0x3F,0xE0,0xFC,0x3E,0xF0,0xFC,0x3E,0xB8,0xFC,0x3E,0xB8,
+    0xFC,0x3E,0x7C,0xFC,0x3E,0x3D,0xFC,0x3E,0x2E,0xFC,0x3E,0x1E,0xFC,0x3E,0x0F,0xFC,
+    0x3E,0x0B,0xFC,0x3E,0x0B,0xFC,0x3E,0x07,0xFC,0x3E,0x03,0xFC,0x3E,0x02,0xFC,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'N'
+    0x00,0x00,0x00,0x00,0x28,0x00,0x02,0xFF,0x80,0x0B,0xFF,0xD0,0x0F,0xFF,0xF0,0x2F,
+    0xD7,0xF8,0x2F,0x82,0xF8,0x3F,0x01,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,
+    0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xFC,
+    0x2F,0x82,0xF8,0x2F,0xD7,0xF8,0x0F,0xFF,0xF0,0x0B,0xFF,0xE0,0x02,0xFF,0x80,0x00,
+    0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'O'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x2F,0xFE,0x80,0x2F,0xFF,0xE0,0x2F,0xFF,0xF8,0x2F,
+    0xAA,0xFC,0x2F,0x81,0xFC,0x2F,0x80,0xFC,0x2F,0x80,0xFC,0x2F,0x81,0xFC,0x2F,0xAA,
+    0xFC,0x2F,0xFF,0xF8,0x2F,0xFF,0xE0,0x2F,0xFE,0x80,0x2F,0x80,0x00,0x2F,0x80,0x00,
+    0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'P'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x2F,0xFE,0x40,0x3F,0xFF,0xE0,0x3F,0xFF,0xF4,0x3F,
+    0xAB,0xF8,0x3F,0x02,0xF8,0x3F,0x02,0xF8,0x3F,0x02,0xF8,0x3F,0x02,0xF8,0x3F,0xAF,
+    0xF0,0x3F,0xFF,0xD0,0x3F,0xFF,0x40,0x3F,0xAF,0xC0,0x3F,0x0B,0xE0,0x3F,0x07,0xE0,
+    0x3F,0x03,0xF4,0x3F,0x02,0xF8,0x3F,0x01,0xFC,0x3F,0x00,0xFE,0x3F,0x00,0xBE,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'R'
+    0x00,0x00,0x00,0x00,0x28,0x00,0x02,0xFF,0x90,0x0B,0xFF,0xF0,0x2F,0xFF,0xF0,0x2F,
+    0x80,0xB0,0x3F,0x00,0x10,0x3F,0x00,0x00,0x3F,0x80,0x00,0x2F,0xF8,0x00,0x0F,0xFF,
+    0x40,0x07,0xFF,0xD0,0x00,0xBF,0xF0,0x00,0x1B,0xF8,0x00,0x02,0xF8,0x00,0x01,0xFC,
+    0x20,0x01,0xFC,0x39,0x02,0xF8,0x3F,0xFF,0xF8,0x3F,0xFF,0xE0,0x1B,0xFF,0x80,0x01,
+    0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'S'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xFF,0xFC,0x3F,0xFF,0xFC,0x3F,0xFF,0xFC,0x2A,
+    0xBE,0xA8,0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,
+    0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,
+    0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'T'
+    0x00,0x00,0x00,0x00,0x00,0x00,0xBE,0x00,0xBE,0x7E,0x00,0xBD,0x3F,0x00,0xFC,0x3F,
+    0x00,0xFC,0x2F,0x40,0xF8,0x2F,0x82,0xF8,0x2F,0x82,0xF8,0x0F,0x82,0xF0,0x0F,0xC3,
+    0xF0,0x0B,0xC3,0xF0,0x0B,0xD3,0xE0,0x0B,0xEB,0xE0,0x03,0xEB,0xD0,0x03,0xEB,0xC0,
+    0x03,0xFB,0xC0,0x02,0xFF,0x80,0x02,0xFF,0x80,0x02,0xFF,0x80,0x00,0xFF,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'V'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x01,0xAA,0x00,0x0B,0xFF,0xD0,0x0F,0xFF,0xF0,0x0E,0xAA,0xF8,0x14,0x01,
+    0xF8,0x00,0xAA,0xF8,0x0B,0xFF,0xF8,0x2F,0xFF,0xF8,0x3F,0xEA,0xF8,0x7F,0x01,0xF8,
+    0xBF,0x02,0xF8,0x7F,0x02,0xF8,0x3F,0x8B,0xF8,0x2F,0xFF,0xF8,0x0B,0xFC,0xF8,0x01,
+    0xA0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'a'
+    0x00,0x00,0x00,0x1A,0x00,0x00,0x2F,0x00,0x00,0x2F,0x00,0x00,0x2F,0x00,0x00,0x2F,
+    0x00,0x00,0x2F,0x0A,0x40,0x2F,0x3F,0xD0,0x2F,0xBF,0xF0,0x2F,0xEB,0xF8,0x2F,0xC2,
+    0xF8,0x2F,0x80,0xFC,0x2F,0x80,0xFC,0x2F,0x00,0xFC,0x2F,0x00,0xFC,0x2F,0x80,0xFC,
+    0x2F,0x80,0xFC,0x2F,0xC2,0xF8,0x2F,0xEB,0xF8,0x2F,0xBF,0xF0,0x2F,0x3F,0xD0,0x00,
+    0x0A,0x40,0x00,0x00,0x00,0x00,0x00,0x00,  // 'b'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x2A,0x40,0x01,0xFF,0xE0,0x07,0xFF,0xF0,0x0B,0xFA,0xB0,0x0F,0xD0,
+    0x24,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,
+    0x2F,0x80,0x00,0x0F,0xD0,0x20,0x0B,0xFA,0xF0,0x07,0xFF,0xF0,0x01,0xFF,0xE0,0x00,
+    0x2A,0x40,0x00,0x00,0x00,0x00,0x00,0x00,  // 'c'
+    0x00,0x00,0x00,0x00,0x01,0xA4,0x00,0x02,0xF8,0x00,0x02,0xF8,0x00,0x02,0xF8,0x00,
+    0x02,0xF8,0x01,0xA2,0xF8,0x0B,0xFA,0xF8,0x1F,0xFF,0xF8,0x2F,0xEF,0xF8,0x3F,0x47,
+    0xF8,0x3F,0x02,0xF8,0x7E,0x02,0xF8,0xBE,0x02,0xF8,0xBE,0x02,0xF8,0x7E,0x02,0xF8,
+    0x3F,0x02,0xF8,0x3F,0x47,0xF8,0x2F,0xEF,0xF8,0x1F,0xFF,0xF8,0x0B,0xFA,0xF8,0x01,
+    0xA0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'd'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x6A,0x00,0x02,0xFF,0xD0,0x0B,0xFF,0xF0,0x1F,0xEB,0xF8,0x2F,0x41,
+    0xFC,0x3F,0x00,0xFC,0x3F,0xFF,0xFD,0x3F,0xFF,0xFE,0x3F,0xFF,0xFE,0x3F,0x00,0x00,
+    0x3F,0x00,0x00,0x2F,0x80,0x1C,0x1F,0xEA,0xFC,0x0B,0xFF,0xFC,0x02,0xFF,0xF8,0x00,
+    0x6A,0x40,0x00,0x00,0x00,0x00,0x00,0x00,  // 'e'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x01,0xA4,0x00,0x07,0xFD,0xF8,0x1F,0xFF,0xF8,0x2F,0x9B,0xF8,0x3F,0x42,
+    0xF8,0x3F,0x02,0xF8,0x3F,0x02,0xF8,0x3E,0x01,0xF8,0x3F,0x02,0xF8,0x3F,0x42,0xF8,
+    0x2F,0xEB,0xF8,0x0F,0xFF,0xF8,0x06,0xF8,0xF8,0x00,0x02,0xF8,0x08,0x02,0xF8,0x0F,
+    0xFF,0xF4,0x0F,0xFF,0xE0,0x0B,0xFE,0x40,  // 'g'
+    0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x29,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x0F,0xFF,0x00,0x0F,0xFF,0x00,0x0B,0xFF,0x00,0x00,0x3F,
+    0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,
+    0x00,0x3F,0x00,0x00,0x3F,0x00,0x2F,0xFF,0xFD,0x2F,0xFF,0xFE,0x2F,0xFF,0xFE,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'i'
+    0x00,0x00,0x00,0x1A,0x40,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,0x2F,
+    0x80,0x00,0x2F,0x80,0x00,0x2F,0x82,0xFC,0x2F,0x87,0xF4,0x2F,0x8F,0xD0,0x2F,0xAF,
+    0x80,0x2F,0xFE,0x00,0x2F,0xFE,0x00,0x2F,0xFF,0x00,0x2F,0xEF,0x80,0x2F,0x8F,0xC0,
+    0x2F,0x8B,0xE0,0x2F,0x87,0xF0,0x2F,0x82,0xF8,0x2F,0x81,0xFC,0x2F,0x80,0xBE,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'k'
+    0x00,0x00,0x00,0x6A,0xA4,0x00,0xBF,0xF8,0x00,0xBF,0xF8,0x00,0x02,0xF8,0x00,0x02,
+    0xF8,0x00,0x02,0xF8,0x00,0x02,0xF8,0x00,0x02,0xF8,0x00,0x02,0xF8,0x00,0x02,0xF8,
+    0x00,0x02,0xF8,0x00,0x02,0xF8,0x00,0x02,0xF8,0x00,0x02,0xF8,0x00,0x02,0xF8,0x00,
+    0x02,0xF8,0x00,0x01,0xFC,0x00,0x00,0xFF,0xF8,0x00,0xBF,0xF8,0x00,0x2F,0xF8,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'l'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0xA1,0xA0,0xBE,0xFB,0xF8,0xBF,0xFF,0xFC,0xBE,0xBE,0xBC,0xBD,0xBD,
+    0x7C,0xBC,0x7C,0x3E,0xBC,0xBC,0x3E,0xBC,0xBC,0x3E,0xBC,0xBC,0x3E,0xBC,0xBC,0x3E,
+    0xBC,0xBC,0x3E,0xBC,0xBC,0x3E,0xBC,0xBC,0x3E,0xBC,0xBC,0x3E,0xBC,0x7C,0x3D,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'm'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x0A,0x40,0x2F,0xAF,0xD0,0x2F,0xFF,0xF0,0x2F,0xEB,0xF4,0x2F,0xC2,
+    0xF8,0x2F,0x82,0xF8,0x2F,0x82,0xF8,0x2F,0x82,0xF8,0x2F,0x82,0xF8,0x2F,0x82,0xF8,
+    0x2F,0x82,0xF8,0x2F,0x82,0xF8,0x2F,0x82,0xF8,0x2F,0x82,0xF8,0x2F,0x82,0xF8,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'n'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0xA9,0x00,0x02,0xFF,0x80,0x0B,0xFF,0xE0,0x1F,0xEB,0xF4,0x2F,0x82,
+    0xF8,0x3F,0x00,0xFC,0x3F,0x00,0xFC,0x3E,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xFC,
+    0x3F,0x01,0xFC,0x2F,0x82,0xF8,0x1F,0xEB,0xF4,0x0B,0xFF,0xE0,0x02,0xFF,0x80,0x00,
+    0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'o'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x0A,0x40,0x2F,0x7F,0xE0,0x2F,0xFF,0xF4,0x2F,0xE6,0xF8,0x2F,0x81,
+    0xFC,0x2F,0x80,0xFC,0x2F,0x80,0xFC,0x2F,0x80,0xFC,0x2F,0x80,0xFC,0x2F,0x81,0xFC,
+    0x2F,0xEA,0xF8,0x2F,0xFF,0xF4,0x2F,0x7F,0xE0,0x2F,0x9A,0x40,0x2F,0x80,0x00,0x2F,
+    0x80,0x00,0x2F,0x80,0x00,0x2F,0x80,0x00,  // 'p'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x01,0xA4,0x0B,0xEB,0xFC,0x0B,0xEF,0xFC,0x0B,0xFF,0xFC,0x0B,0xF8,
+    0x05,0x0B,0xF0,0x00,0x0B,0xE0,0x00,0x0B,0xE0,0x00,0x0B,0xE0,0x00,0x0B,0xE0,0x00,
+    0x0B,0xE0,0x00,0x0B,0xE0,0x00,0x0B,0xE0,0x00,0x0B,0xE0,0x00,0x0B,0xE0,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'r'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0xAA,0x40,0x07,0xFF,0xE0,0x0F,0xFF,0xE0,0x2F,0xAA,0xA0,0x2F,0x80,
+    0x10,0x2F,0x90,0x00,0x1F,0xFA,0x00,0x0B,0xFF,0xD0,0x02,0xFF,0xF0,0x00,0x2B,0xF4,
+    0x00,0x02,0xF8,0x14,0x02,0xF8,0x2E,0xAB,0xF4,0x2F,0xFF,0xF0,0x1F,0xFF,0xD0,0x01,
+    0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 's'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xF8,0x00,0x02,0xF8,0x00,0x02,
+    0xF8,0x00,0x02,0xF8,0x00,0x3F,0xFF,0xF8,0x3F,0xFF,0xF8,0x2F,0xFF,0xF4,0x02,0xF8,
+    0x00,0x02,0xF8,0x00,0x02,0xF8,0x00,0x02,0xF8,0x00,0x02,0xF8,0x00,0x02,0xF8,0x00,
+    0x02,0xF8,0x00,0x01,0xF8,0x00,0x00,0xFF,0xF4,0x00,0xBF,0xF8,0x00,0x2F,0xF8,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 't'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x2F,0x82,0xF8,0x2F,0x82,0xF8,0x2F,0x82,0xF8,0x2F,0x82,
+    0xF8,0x2F,0x82,0xF8,0x2F,0x82,0xF8,0x2F,0x82,0xF8,0x2F,0x82,0xF8,0x2F,0x82,0xF8,
+    0x2F,0x82,0xF8,0x2F,0x82,0xF8,0x1F,0xEB,0xF8,0x0F,0xFF,0xF8,0x07,0xFA,0xF8,0x01,
+    0xA0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'u'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0xFD,0x3F,0x00,0xFC,0x2F,0x41,0xF8,0x2F,0x82,
+    0xF8,0x0F,0x82,0xF0,0x0F,0xC3,0xF0,0x0B,0xC3,0xE0,0x0B,0xEB,0xE0,0x03,0xEB,0xD0,
+    0x03,0xEB,0xC0,0x02,0xFF,0x80,0x02,0xFF,0x80,0x01,0xFF,0x40,0x00,0xFF,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'v'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x2F,0x82,0xFC,0x1F,0xC2,0xF8,0x0B,0xE7,0xF0,0x07,0xEB,
+    0xD0,0x02,0xFF,0x80,0x00,0xFF,0x40,0x00,0xBE,0x00,0x00,0xBF,0x00,0x02,0xFF,0x80,
+    0x03,0xFB,0xD0,0x0B,0xEB,0xE0,0x0F,0xC3,0xF4,0x2F,0x82,0xF8,0x7F,0x40,0xFD,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 'x'
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0xBE,0x3F,0x00,0xFC,0x2F,0x82,0xF8,0x1F,0x82,
+    0xF4,0x0F,0xC3,0xF0,0x0B,0xE7,0xE0,0x07,0xEB,0xE0,0x03,0xFB,0xC0,0x02,0xFF,0x80,
+    0x00,0xFF,0x80,0x00,0xBF,0x00,0x00,0xBE,0x00,0x00,0xBE,0x00,0x00,0xFC,0x00,0x2A,
+    0xF8,0x00,0x3F,0xF4,0x00,0x3F,0x90,0x00,  // 'y'
+};
+
+const AAFont fontAA24 = { fontAA24Table, 12, 24, Font48_Map };
+
+#endif // FONT_SUBSET
@@ -1,5 +1,6 @@
 #include <msp430.h>
 #include <stdint.h>
+#include "fonts.h"
 
 /*
  * Take 'A' as example.
@@ -25,6 +26,7 @@
  *
  **/
 
+#if !FONT_SUBSET    // O subconjunto de fonts-subset.c substitui a tabela completa
 // standard ascii 5x7 font
 const uint8_t font5x7[][5] = {
     {0x00, 0x00, 0x00, 0x00, 0x00},  // 0x00 (nul)
@@ -282,9 +284,44 @@ const uint8_t font5x7[][5] = {
     {0x00, 0x1F, 0x01, 0x01, 0x1E},  // 0xFC
     {0x00, 0x19, 0x1D, 0x17, 0x12},  // 0xFD
     {0x00, 0x3C, 0x3C, 0x3C, 0x3C},  // 0xFE
-    {0x00, 0x00, 0x00, 0x00, 0x00}   // 0xFF
+    {0x00, 0x00, 0x00, 0x00, 0x00},  // 0xFF
+    // 0x100..: maiúsculas acentuadas do português e ã/õ, ausentes do CP437
+    {0x78, 0x15, 0x16, 0x14, 0x78},  // 0x100 À
+    {0x78, 0x14, 0x16, 0x15, 0x78},  // 0x101 Á
+    {0x78, 0x16, 0x15, 0x16, 0x78},  // 0x102 Â
+    {0x7A, 0x15, 0x15, 0x16, 0x79},  // 0x103 Ã
+    {0x7C, 0x56, 0x55, 0x56, 0x44},  // 0x104 Ê
+    {0x00, 0x44, 0x7E, 0x45, 0x00},  // 0x105 Í
+    {0x38, 0x44, 0x46, 0x45, 0x38},  // 0x106 Ó
+    {0x38, 0x46, 0x45, 0x46, 0x38},  // 0x107 Ô
+    {0x3A, 0x45, 0x45, 0x46, 0x39},  // 0x108 Õ
+    {0x3C, 0x40, 0x42, 0x41, 0x3C},  // 0x109 Ú
+    {0x22, 0x55, 0x55, 0x7A, 0x41},  // 0x10A ã
+    {0x32, 0x49, 0x49, 0x4A, 0x31},  // 0x10B õ
 };
 
+// Latin-1 0xA0..0xFF -> glifo em font5x7: o equivalente do CP437, um dos
+// glifos acrescentados em 0x100, ou a letra sem acento (ou '?') para o resto
+const uint16_t font5x7Latin1[96] = {
+    ' ',   0xAD,  0x9B,  0x9C,  0x0F,  0x9D,  '|',   0x15,   // NBSP ¡ ¢ £ ¤ ¥ ¦ §
+    '"',   '?',   0xA6,  0xAE,  0xAA,  '-',   '?',   '-',    // ¨ © ª « ¬ SHY ® ¯
+    0xF8,  0xF1,  0xFD,  '3',   '\'', 0xE6,  0x14,  0xFA,   // ° ± ² ³ ´ µ ¶ ·
+    ',',   '1',   0xA7,  0xAF,  0xAC,  0xAB,  '?',   0xA8,   // ¸ ¹ º » ¼ ½ ¾ ¿
+    0x100, 0x101, 0x102, 0x103, 0x8E,  0x8F,  0x92,  0x80,   // À Á Â Ã Ä Å Æ Ç
+    'E',   0x90,  0x104, 'E',   'I',   0x105, 'I',   'I',    // È É Ê Ë Ì Í Î Ï
+    'D',   0xA5,  'O',   0x106, 0x107, 0x108, 0x99,  'x',    // Ð Ñ Ò Ó Ô Õ Ö ×
+    'O',   'U',   0x109, 'U',   0x9A,  'Y',   'P',   0xE1,   // Ø Ù Ú Û Ü Ý Þ ß
+    0x85,  0xA0,  0x83,  0x10A, 0x84,  0x86,  0x91,  0x87,   // à á â ã ä å æ ç
+    0x8A,  0x82,  0x88,  0x89,  0x8D,  0xA1,  0x8C,  0x8B,   // è é ê ë ì í î ï
+    0xEB,  0xA4,  0x95,  0xA2,  0x93,  0x10B, 0x94,  0xF6,   // ð ñ ò ó ô õ ö ÷
+    0xED,  0x97,  0xA3,  0x96,  0x81,  'y',   'p',   0x98,   // ø ù ú û ü ý þ ÿ
+};
+#endif
+
+// Tabela original da fonte 20x28 (um uint32_t por coluna, bit 27 = linha de
+// cima). O firmware usa a versão RLE de fonts-rle.c; esta só é compilada
+// para o gerador e o benchmark de sim/ (FONT20X28_TABLE = 1).
+#if FONT20X28_TABLE
 const uint32_t font20x28[][20] = {
     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 
     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 
@@ -408,3 +445,33 @@ const uint32_t font20x28[][20] = {
     {0x0, 0x0, 0x0, 0x0, 0x7fff80, 0x7fff80, 0x7fff80, 0x38e, 0x38e, 0x38e, 0x38e, 0x38e, 0x38e, 0x7ffff0, 0x7ffff0, 0x7ffff0, 0x0, 0x0, 0x0, 0x0},                                                       // y 
     {0x0, 0x0, 0x0, 0xe0070, 0xe00f0, 0xe01f0, 0xe03f0, 0xe0770, 0xe0e70, 0xe1c70, 0xe7870, 0xe7070, 0xee070, 0xfc070, 0xfc070, 0xf0070, 0xe0070, 0x0, 0x0, 0x0}                                          // z 
 };
+#endif
+
+// Próximo caractere de um texto UTF-8, em Latin-1. Pontos de código acima de
+// 0xFF (e os controles C1) viram '?'; um byte que não inicia uma sequência
+// UTF-8 válida é tomado como Latin-1, então textos em Latin-1 também
+// funcionam. O terminador falha no teste de continuação, então a leitura
+// nunca passa do fim da string.
+uint8_t utf8Next(const char **p)
+{
+    const uint8_t *s = (const uint8_t *)*p;
+    uint8_t c = s[0];
+    uint16_t cp;
+
+    if (c >= 0xC2 && c <= 0xDF && (s[1] & 0xC0) == 0x80) {
+        cp = (uint16_t)(c & 0x1F) << 6 | (s[1] & 0x3F);
+        *p += 2;
+        return cp >= 0xA0 && cp <= 0xFF ? cp : '?';
+    }
+    if (c >= 0xE0 && c <= 0xEF && (s[1] & 0xC0) == 0x80 && (s[2] & 0xC0) == 0x80) {
+        *p += 3;
+        return '?';
+    }
+    if (c >= 0xF0 && c <= 0xF4 && (s[1] & 0xC0) == 0x80 && (s[2] & 0xC0) == 0x80 &&
+        (s[3] & 0xC0) == 0x80) {
+        *p += 4;
+        return '?';
+    }
+    *p += 1;               // ASCII ou Latin-1
+    return c;
+}
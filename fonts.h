@@ -4,7 +4,84 @@
 #include <msp430.h>
 #include <stdint.h>
 
+// 1: só os glifos de fonts-subset.c entram no build (gerado por sim/fontsubset)
+#ifndef FONT_SUBSET
+#define FONT_SUBSET 0
+#endif
+
 extern const uint8_t font5x7[][5];
+
+// Próximo caractere de um texto UTF-8, em Latin-1, avançando *p
+uint8_t utf8Next(const char **p);
+
+// Colunas do glifo do caractere Latin-1 c na font5x7 (o texto UTF-8 é
+// convertido para Latin-1 por utf8Next). Abaixo de 0xA0 o índice é o próprio
+// código, como no CP437 da tabela; 0xA0..0xFF passam por font5x7Latin1, que
+// aponta para o glifo CP437 equivalente ou para os acentos acrescentados a
+// partir de 0x100. No subconjunto, font5x7Map leva ' '..0xFF ao índice do
+// glifo; o resto cai no índice 0 (espaço). c é avaliado mais de uma vez.
+#define FONT5X7_MAP 224     // Caracteres ' '..0xFF do mapa do subconjunto
+#if FONT_SUBSET
+extern const uint8_t font5x7Map[FONT5X7_MAP];
+#define FONT5X7(c)  font5x7[(uint8_t)((uint8_t)(c) - ' ') < FONT5X7_MAP ? font5x7Map[(uint8_t)(c) - ' '] : 0]
+#else
+extern const uint16_t font5x7Latin1[96];
+#define FONT5X7(c)  font5x7[(uint8_t)(c) < 0xA0 ? (uint8_t)(c) : font5x7Latin1[(uint8_t)(c) - 0xA0]]
+#endif
+
+// Fonte 20x28 em RLE: para cada caractere ' '..DEL, trechos alternados de
+// fundo e frente (começando pelo fundo), um byte por trecho, percorrendo o
+// glifo por colunas de cima para baixo. O fundo final é omitido; trechos
+// maiores que 255 são divididos com um trecho de comprimento 0 no meio.
+// O glifo de c ocupa font20x28Rle[font20x28Idx[c - ' ']] até o início do próximo.
+#define FONT20X28_W      20
+#define FONT20X28_H      28
+#define FONT20X28_FIRST  ' '
+#define FONT20X28_COUNT  96
+
+extern const uint16_t font20x28Idx[FONT20X28_COUNT + 1];
+extern const uint8_t  font20x28Rle[];
+
+#ifndef FONT20X28_TABLE
+#define FONT20X28_TABLE 0
+#endif
+#if FONT20X28_TABLE
 extern const uint32_t font20x28[][20];
+#endif
+
+// Fonte proporcional (drawStringProp/measureString): glifos cortados às
+// colunas acesas, um byte por coluna (bit 0 = linha de cima) como a font5x7.
+// O glifo k (caractere first + k) ocupa cols[offset[k]] até cols[offset[k + 1]]
+// e é seguido de spacing colunas de fundo. kern[kernIdx[k]] até
+// kern[kernIdx[k + 1]] são os pares com k à esquerda; dx soma-se ao
+// espaçamento e nunca o torna negativo. Gerada por sim/fontprop.
+typedef struct {
+    char   right;           // Caractere à direita
+    int8_t dx;              // Ajuste do espaçamento, em colunas
+} KernPair;
+
+typedef struct {
+    const uint8_t  * cols;
+    const uint16_t * offset;    // count + 1 entradas
+    const uint16_t * kernIdx;   // count + 1 entradas
+    const KernPair * kern;
+    uint8_t first, count;       // Caracteres first..first + count - 1 (os demais viram first)
+    uint8_t spacing;            // Colunas de fundo entre glifos
+} PropFont;
+
+extern const PropFont font5x7Prop;
+
+// Fonte anti-aliased de 2 bits por pixel (drawStringAA): nível 0 = fundo,
+// 3 = frente, 1 e 2 = misturas a 1/3 e 2/3. Glifos ' '..'~' de width x height
+// guardados por linhas de (width + 3) / 4 bytes, quatro pixels por byte com o
+// da esquerda nos bits 7..6. map segue o sFONT (0 = tabela completa).
+// Gerada por sim/fontaa.
+typedef struct {
+    const uint8_t * table;
+    uint16_t width, height;
+    const uint8_t * map;        // ' '..'~' -> glifo em table (FONT_SUBSET)
+} AAFont;
+
+extern const AAFont fontAA24;
 
 #endif // __FONTS_H
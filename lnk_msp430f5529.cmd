@@ -138,6 +138,7 @@ SECTIONS
 {
     .bss        : {} > RAM                  /* Global & static vars              */
     .data       : {} > RAM                  /* Global & static vars              */
+    .usbram     : {} > USBRAM, type = NOINIT  /* Glyph cache, USB module unused */
     .TI.noinit  : {} > RAM                  /* For #pragma noinit                */
     .sysmem     : {} > RAM                  /* Dynamic memory allocation area    */
     .stack      : {} > RAM (HIGH)           /* Software system stack             */
@@ -1,12 +1,233 @@
 #include <msp430.h> 
+#include <stdint.h>
 #include "tft-lcd.h"
 #include "clock-lcd.h"
 #include "time-ctrl.h"
+#include "sched.h"
+
+#define ROUNDS      100                     // Voltas pelas telas antes de parar
+#define SHOW_MS     2000                    // Tempo de cada tela
+#define BLANK_MS    1000                    // Tela preta entre duas telas
+#define DEBOUNCE_MS 20                      // Espera até confirmar um aperto do botão S2 (P1.1)
+#define BAND_H      40                      // Linhas limpas por fatia (~25 KB no barramento)
+#define BANDS       (240 / BAND_H)
+
+typedef struct {
+    uint16_t x, y;
+    const char * str;
+    tft_color_t color;
+} MenuLine;
+
+typedef struct {
+    const MenuLine * lines;
+    uint8_t n;
+} MenuScreen;
+
+static const MenuLine ovos[] = {
+    {   5,   5, "ISM",                       TFT_HEX(0x0188D6) },
+    { 120,  40, "COMPLEMENTO",               TFT_BLACK },
+    { 120, 100, "Ovos mexidos",              TFT_BLACK },
+    {  80, 120, "Contém: Leite e derivados", TFT_RED },
+    {  80, 140, "        ovos",              TFT_RED },
+    {  10, 220, "Porção: 100g",              TFT_BLACK },
+    { 210, 220, "Valor Cal: 30kCal",         TFT_BLACK },
+};
+
+static const MenuLine frango[] = {
+    {   5,   5, "ISM",                       TFT_HEX(0x0188D6) },
+    { 120,  40, "PRATO PRINCIPAL",           TFT_BLACK },
+    {  90, 100, "Isca de Frango acebolada",  TFT_BLACK },
+    {  10, 220, "Porção: 200g",              TFT_BLACK },
+    { 210, 220, "Valor Cal: 60kCal",         TFT_BLACK },
+};
+
+static const MenuLine sopa[] = {
+    {   5,   5, "ISM",                       TFT_HEX(0x0188D6) },
+    { 140,  40, "Sopa",                      TFT_BLACK },
+    {  90, 100, "Sopa de cenoura com curry", TFT_BLACK },
+    {  80, 120, "      e leite de  coco",    TFT_BLACK },
+    {  10, 220, "Porção: 150ml",             TFT_BLACK },
+    { 210, 220, "Valor Cal: 15kCal",         TFT_BLACK },
+};
+
+#define SCREEN(t)   { t, sizeof(t) / sizeof(t[0]) }
+
+static const MenuScreen screens[] = { SCREEN(ovos), SCREEN(frango), SCREEN(sopa) };
+
+#define SCREENS     (sizeof(screens) / sizeof(screens[0]))
+
+static uint8_t  screen;                     // Tela atual (ou a próxima, durante o preto)
+static uint8_t  rounds;                     // Voltas completas pelas telas
+static uint8_t  next = SCHED_NONE;          // Temporizador da próxima troca
+static uint8_t  busy;                       // 1 enquanto uma tela está sendo desenhada
+static uint8_t  shown;                      // 1 com uma tela do cardápio visível
+static uint16_t seconds;                    // Tempo desde o boot
+static uint8_t  pressed;                    // Aperto à espera do fim do desenho
+static SchedFn  phase;                      // Cadeia de fatias válida (show ou blank)...
+static uint8_t  step;                       // ...e o passo que ela espera
+
+// Relógio mm:ss no canto superior direito, por cima da tela visível. Os
+// algarismos vêm de um literal para entrarem no subconjunto das fontes
+static void clockDraw()
+{
+    static const char digits[] = "0123456789";
+    char buf[6];
+    uint16_t m = seconds / 60 % 100, s = seconds % 60;
+
+    if (!shown || busy)
+        return;
+    buf[0] = digits[m / 10];
+    buf[1] = digits[m % 10];
+    buf[2] = ':';
+    buf[3] = digits[s / 10];
+    buf[4] = digits[s % 10];
+    buf[5] = 0;
+    drawStringLine(285, 5, buf, TFT_BLACK, TFT_WHITE);
+}
+
+static void clockTick(uint8_t arg)
+{
+    seconds++;
+    clockDraw();
+}
+
+// Só um passo de uma cadeia é válido por vez: um evento que já estava na
+// fila quando a cadeia foi trocada (um prazo vencido antes do botão, por
+// exemplo) não bate com phase/step e é descartado por current()
+static void expect(SchedFn fn, uint8_t n)
+{
+    phase = fn;
+    step  = n;
+}
+
+static uint8_t current(SchedFn fn, uint8_t n)
+{
+    return phase == fn && step == n;
+}
+
+static void chain(SchedFn fn, uint8_t n)
+{
+    expect(fn, n);
+    schedPost(fn, n);
+}
+
+static void show(uint8_t n);
+static void blank(uint8_t n);
+
+// Pula para a próxima tela sem esperar o prazo da atual
+static void skip()
+{
+    pressed = 0;
+    schedCancel(next);
+    next = SCHED_NONE;
+    if (shown)
+        screen = (screen + 1) % SCREENS;
+    chain(show, 0);
+}
+
+// Desenha a tela atual em fatias: as faixas da limpeza e depois uma linha de
+// texto por chamada, voltando à fila entre elas
+static void show(uint8_t n)
+{
+    const MenuScreen * sc = &screens[screen];
+
+    if (!current(show, n))
+        return;
+    busy = 1;
+    shown = 1;
+    if (n < BANDS) {
+        fillRect(0, n * BAND_H, 320, BAND_H, TFT_WHITE);
+    } else if (n - BANDS < sc->n) {
+        const MenuLine * l = &sc->lines[n - BANDS];
+
+        drawStringLine(l->x, l->y, l->str, l->color, TFT_WHITE);
+    } else {
+        busy = 0;
+        clockDraw();
+        if (pressed) {
+            skip();
+        } else {
+            expect(blank, 0);
+            next = schedAfter(SHOW_MS, blank, 0);
+        }
+        return;
+    }
+    chain(show, n + 1);
+}
+
+// Apaga a tela em faixas e agenda a próxima; para depois de ROUNDS voltas
+static void blank(uint8_t n)
+{
+    if (!current(blank, n))
+        return;
+    busy = 1;
+    shown = 0;
+    if (n < BANDS) {
+        fillRect(0, n * BAND_H, 320, BAND_H, TFT_BLACK);
+        chain(blank, n + 1);
+        return;
+    }
+    busy = 0;
+    if (++screen == SCREENS) {
+        screen = 0;
+        if (++rounds == ROUNDS) {
+            schedStop();
+            return;
+        }
+    }
+    if (pressed) {
+        skip();
+    } else {
+        expect(show, 0);
+        next = schedAfter(BLANK_MS, show, 0);
+    }
+}
+
+// Botão S2 (P1.1, ativo em 0): um aperto ainda presente DEBOUNCE_MS depois
+// da borda pula para a próxima tela sem esperar o prazo. Durante o desenho o
+// aperto fica guardado e é atendido quando a tela termina.
+static void buttonCheck(uint8_t arg)
+{
+    P1IFG &= ~BIT1;                         // Descarta os repiques da espera...
+    P1IE  |= BIT1;                          // ...e volta a ouvir o botão
+    if (P1IN & BIT1)
+        return;                             // Solto: era ruído
+    if (busy)
+        pressed = 1;
+    else
+        skip();
+}
+
+// Primeira borda de descida: a confirmação fica para depois dos repiques
+static void buttonEdge(uint8_t arg)
+{
+    if (schedAfter(DEBOUNCE_MS, buttonCheck, 0) == SCHED_NONE)
+        buttonCheck(0);                     // Sem temporizador livre: lê já
+}
+
+#pragma vector=PORT1_VECTOR
+__interrupt void PORT1_ISR(void)
+{
+    switch (__even_in_range(P1IV, P1IV_P1IFG7)) {
+    case P1IV_P1IFG1:
+        P1IE &= ~BIT1;                      // Ignora os repiques até buttonCheck
+        if (schedPost(buttonEdge, 0))
+            __bic_SR_register_on_exit(LPM3_bits);
+        else
+            P1IE |= BIT1;                   // Fila cheia: este aperto se perde
+        break;
+    default:
+        break;
+    }
+}
 
 int main(void)
 {
 	WDTCTL = WDTPW | WDTHOLD;	// stop watchdog timer
 
+    timeConfig();                           // Timer_A0 em ACLK: base dos prazos do display
+    tftConfig();                            // Começa o reset do display; a sequência corre em paralelo
+
     SetVcoreUp(1);
     SetVcoreUp(2);
     SetVcoreUp(3);
@@ -19,55 +240,24 @@ int main(void)
                                             // Fórmula: (N + 1) * FLLRef = Fdco
                                             // (761 + 1) * 32768 = 25 MHz
     __bic_SR_register(SCG0);                // Reativa o loop de controle do FLL
-    UCSCTL4 |= SELA_3;                      // Seleciona ACLK como MCLK/1024
-    UCSCTL5 |= DIVPA_5 | DIVA_5;            // Divide ACLK por 32
+    UCSCTL5 |= DIVPA_5;                     // ACLK (REFO, ver timeConfig) dividido por 32 no pino
     P1DIR |= BIT0;                          // Configura P1.0 como saída
     P1SEL |= BIT0;                          // Seleciona a função alternativa de P1.0 (ACLK)
+    tftInitPoll();                          // Avança a inicialização do display, se a espera venceu
 
-	tftConfig();
-
-	uint8_t j = 100;
-    while (j--) {
-        LCD_Clear(0xff, 0xff, 0xff, 1);
-
-        drawString(5, 5, "ISM", 1, 136, 214);
-        drawString(120, 40, "COMPLEMENTO", 0x0, 0x0000, 0x0000);
-        drawString(120, 100, "Ovos mexidos", 0x0000, 0x0000, 0x0000);
-        drawString(80, 120, "Contem: Leite e derivados", 255, 0x0000, 0x0000);
-        drawString(80, 140, "        ovos", 255, 0x0000, 0x0000);
-        drawString(10, 220, "Porcao: 100g", 0x0, 0x0000, 0x0000);
-        drawString(210, 220, "Valor Cal: 30kCal", 0x0, 0x0000, 0x0000);
-
-        delay(2000);
-        LCD_Clear(0, 0, 0, 1);
-        delay(1000);
-        LCD_Clear(0xff, 0xff, 0xff, 1);
-
-        drawString(5, 5, "ISM", 1, 136, 214);
-        drawString(120, 40, "PRATO PRINCIPAL", 0x0, 0x0000, 0x0000);
-        drawString(90, 100, "Isca de Frango acebolada", 0x0000, 0x0000, 0x0000);
-        //drawString(80, 120, "Contem: Leite e derivados", 255, 0x0000, 0x0000);
-        //drawString(80, 140, "        ovos", 255, 0x0000, 0x0000);
-        drawString(10, 220, "Porcao: 200g", 0x0, 0x0000, 0x0000);
-        drawString(210, 220, "Valor Cal: 60kCal", 0x0, 0x0000, 0x0000);
-
-        delay(2000);
-        LCD_Clear(0, 0, 0, 1);
-        delay(1000);
-        LCD_Clear(0xff, 0xff, 0xff, 1);
-
-        drawString(5, 5, "ISM", 1, 136, 214);
-        drawString(140, 40, "Sopa", 0x0, 0x0000, 0x0000);
-        drawString(90, 100, "Sopa de cenoura com curry", 0x0000, 0x0000, 0x0000);
-        drawString(80, 120, "      e leite de  coco", 0, 0x0000, 0x0000);
-        drawString(10, 220, "Porcao: 150ml", 0x0, 0x0000, 0x0000);
-        drawString(210, 220, "Valor Cal: 15kCal", 0x0, 0x0000, 0x0000);
-
-        delay(2000);
-        LCD_Clear(0, 0, 0, 1);
-        delay(1000);
-    }
+    P1DIR &= ~BIT1;                         // P1.1 (botão S2) como entrada...
+    P1REN |= BIT1;                          // ...com resistor...
+    P1OUT |= BIT1;                          // ...de pull-up
+    P1IES |= BIT1;                          // Interrupção na borda de descida (aperto)
+    P1IFG &= ~BIT1;
+    P1IE  |= BIT1;
+
+    schedConfig();                          // Tick de 100 Hz no CCR1 do Timer_A0
+    schedEvery(1000, clockTick, 0);
+    chain(show, 0);
+    schedRun();                             // Até a última volta pelas telas
 
+    P1IE &= ~BIT1;                          // O botão não tem mais o que fazer
     __bis_SR_register(LPM4_bits);
 
 	return 0;
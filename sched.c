@@ -0,0 +1,165 @@
+/// sched.c - Escalonador cooperativo sobre o CCR1 do Timer_A0
+#include <msp430.h>
+#include <stdint.h>
+#include "time-ctrl.h"
+#include "sched.h"
+
+typedef struct {
+    SchedFn  fn;           // 0 = livre
+    uint8_t  arg;
+    uint16_t due;          // Tick do próximo disparo
+    uint16_t period;       // Ticks entre disparos (0 = disparo único)
+} SchedTimer;
+
+typedef struct {
+    SchedFn fn;
+    uint8_t arg;
+} SchedEvent;
+
+static struct {
+    SchedTimer timer[SCHED_TIMERS];
+    SchedEvent ring[SCHED_QUEUE];
+    volatile uint8_t  head;    // Próxima escrita (programa e ISRs)
+    volatile uint8_t  tail;    // Próxima leitura (schedRun)
+    volatile uint16_t ticks;
+    volatile uint16_t wake;    // Tick em que o ISR do tick acorda o laço
+    uint8_t  frac;             // Resto acumulado de TIME_HZ / SCHED_HZ
+    uint8_t  run;
+} sched;
+
+uint8_t schedPost(SchedFn fn, uint8_t arg)
+{
+    uint16_t gie = __get_interrupt_state();
+    uint8_t next, ok = 0;
+
+    __disable_interrupt();     // Também chamada por ISRs: restaura o GIE anterior
+    next = (sched.head + 1) & (SCHED_QUEUE - 1);
+    if (next != sched.tail) {
+        sched.ring[sched.head].fn  = fn;
+        sched.ring[sched.head].arg = arg;
+        sched.head = next;
+        ok = 1;
+    }
+    __set_interrupt_state(gie);
+    return ok;
+}
+
+// Põe na fila os temporizadores vencidos e calcula o próximo tick em que o
+// ISR precisa acordar o laço
+static void timersRun()
+{
+    uint16_t now = sched.ticks;
+    uint16_t wake = now + 0x7FFF;
+    SchedTimer * t;
+
+    for (t = sched.timer; t < sched.timer + SCHED_TIMERS; t++) {
+        if (!t->fn)
+            continue;
+        if ((int16_t)(now - t->due) >= 0) {
+            if (!schedPost(t->fn, t->arg))
+                continue;          // Fila cheia: o prazo continua vencido
+            if (!t->period) {
+                t->fn = 0;
+                continue;
+            }
+            t->due += t->period;   // Do prazo anterior: o atraso não acumula
+        }
+        if ((int16_t)(t->due - wake) < 0)
+            wake = t->due;
+    }
+    sched.wake = wake;
+}
+
+static uint8_t timerAdd(uint16_t ms, uint16_t period, SchedFn fn, uint8_t arg)
+{
+    uint8_t i;
+
+    for (i = 0; i < SCHED_TIMERS; i++) {
+        if (sched.timer[i].fn)
+            continue;
+        sched.timer[i].arg    = arg;
+        sched.timer[i].due    = sched.ticks + SCHED_MS(ms);
+        sched.timer[i].period = period;
+        sched.timer[i].fn     = fn;
+        timersRun();
+        return i;
+    }
+    return SCHED_NONE;
+}
+
+uint8_t schedAfter(uint16_t ms, SchedFn fn, uint8_t arg)
+{
+    return timerAdd(ms, 0, fn, arg);
+}
+
+uint8_t schedEvery(uint16_t ms, SchedFn fn, uint8_t arg)
+{
+    return timerAdd(ms, SCHED_MS(ms), fn, arg);
+}
+
+void schedCancel(uint8_t id)
+{
+    if (id < SCHED_TIMERS)
+        sched.timer[id].fn = 0;
+}
+
+uint16_t schedTicks()
+{
+    return sched.ticks;
+}
+
+void schedConfig()
+{
+    sched.head  = sched.tail = 0;
+    sched.ticks = 0;
+    sched.wake  = 0x7FFF;
+    TA0CCR1  = timeNow() + TIME_HZ / SCHED_HZ;
+    TA0CCTL1 = CCIE;       // Tick pela comparação do CCR1; o CCR0 fica com delayUntil()
+    __enable_interrupt();
+}
+
+void schedRun()
+{
+    SchedEvent ev;
+
+    sched.run = 1;
+    while (sched.run) {
+        timersRun();
+        if (sched.tail != sched.head) {
+            ev = sched.ring[sched.tail];
+            sched.tail = (sched.tail + 1) & (SCHED_QUEUE - 1);
+            ev.fn(ev.arg);
+            continue;
+        }
+        __disable_interrupt();
+        if (sched.tail == sched.head && (int16_t)(sched.ticks - sched.wake) < 0)
+            __bis_SR_register(LPM3_bits | GIE);   // Acorda no prazo ou num evento de ISR
+        __bic_SR_register(SCG1 | SCG0);
+        __enable_interrupt();
+    }
+}
+
+void schedStop()
+{
+    sched.run = 0;
+}
+
+#pragma vector=TIMER0_A1_VECTOR
+__interrupt void TIMER0_A1_ISR(void)
+{
+    switch (__even_in_range(TA0IV, TA0IV_TAIFG)) {
+    case TA0IV_TACCR1:
+        TA0CCR1 += TIME_HZ / SCHED_HZ;        // 327 ticks de ACLK...
+        sched.frac += TIME_HZ % SCHED_HZ;
+        if (sched.frac >= SCHED_HZ) {         // ...e um a mais a cada tantos, para 100 Hz exatos
+            sched.frac -= SCHED_HZ;
+            TA0CCR1++;
+        }
+        sched.ticks++;
+        if ((int16_t)(sched.ticks - sched.wake) >= 0)
+            __bic_SR_register_on_exit(LPM3_bits);
+        break;
+    default:
+        break;
+    }
+}
@@ -0,0 +1,44 @@
+/// sched.h - Escalonador cooperativo: temporizadores, trabalho adiado e eventos
+#ifndef __SCHED_H
+#define __SCHED_H
+
+#include <msp430.h>
+#include <stdint.h>
+
+#define SCHED_HZ     100    // Ticks por segundo (CCR1 do Timer_A0, em ACLK)
+#define SCHED_TIMERS 8      // Temporizadores simultâneos
+#define SCHED_QUEUE  16     // Entradas da fila de eventos (potência de 2)
+#define SCHED_NONE   0xFF   // Nenhum temporizador livre
+
+// Converte ms em ticks do escalonador, arredondando para cima
+#define SCHED_MS(ms) ((uint16_t)(((uint32_t)(ms) * SCHED_HZ + 999) / 1000))
+
+// Trabalho executado pelo laço principal, sempre até o fim: quem tem mais a
+// fazer desenha uma fatia limitada (uma faixa de tela, uma linha de texto) e
+// se repõe na fila com schedPost(fn, arg + 1), deixando passar os eventos
+// que chegaram nesse meio tempo. Nunca chamar delay() aqui.
+typedef void (*SchedFn)(uint8_t arg);
+
+// A fila é a mesma para eventos de ISRs e trabalho adiado pelo programa. Um
+// ISR que chama schedPost() termina com __bic_SR_register_on_exit(LPM3_bits)
+// para acordar o laço. Devolve 0 se a fila estava cheia.
+uint8_t  schedPost  (SchedFn fn, uint8_t arg);
+
+// Temporizadores em ms (resolução de um tick, até 65 s): fn(arg) entra na
+// fila quando o prazo vence; schedEvery repete com o mesmo período, sem
+// acumular atraso. Devolvem o identificador para schedCancel. Só pelo
+// programa, não por ISRs.
+uint8_t  schedAfter (uint16_t ms, SchedFn fn, uint8_t arg);
+uint8_t  schedEvery (uint16_t ms, SchedFn fn, uint8_t arg);
+void     schedCancel(uint8_t id);
+
+uint16_t schedTicks ();     // Ticks desde schedConfig()
+
+// schedConfig() liga o tick (requer timeConfig()). schedRun() atende a fila
+// e os temporizadores e dorme em LPM3 quando não há nada a fazer; retorna
+// depois de schedStop().
+void     schedConfig();
+void     schedRun   ();
+void     schedStop  ();
+
+#endif // __SCHED_H
@@ -0,0 +1,124 @@
+/// bench-font.c - Fonte 20x28: tabela uint32_t por coluna x RLE
+///
+/// Confere que o RLE de fonts-rle.c reproduz a tabela font20x28 glifo a
+/// glifo e compara flash, trabalho de decodificação por glifo e bytes no
+/// barramento. O MSP430 não desloca vários bits numa instrução, então o custo
+/// da tabela é contado em passos de deslocamento de 32 bits (cada um com duas
+/// instruções RRC/RLC); o tempo no host é só indicativo. Uso: make -C sim bench
+#include <msp430.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+#include "ili9341.h"
+#include "tft-lcd.h"
+#include "bench.h"
+#include "fonts.h"
+
+#define REPEAT 20000
+
+static volatile uint32_t sink;
+
+// Decodificação antiga: testa cada bit com 1 << (27 - row)
+static uint32_t decodeTable(uint8_t k, uint32_t *shifts)
+{
+    uint32_t lit = 0;
+    uint8_t col, row;
+
+    for (col = 0; col < FONT20X28_W; col++)
+        for (row = 0; row < FONT20X28_H; row++) {
+            *shifts += FONT20X28_H - 1 - row;
+            lit += (font20x28[k][col] >> (FONT20X28_H - 1 - row)) & 1;
+        }
+    return lit;
+}
+
+// Decodificação RLE: um byte lido por trecho
+static uint32_t decodeRle(uint8_t k, uint32_t *runs)
+{
+    const uint8_t *p = font20x28Rle + font20x28Idx[k];
+    const uint8_t *end = font20x28Rle + font20x28Idx[k + 1];
+    uint32_t lit = 0;
+    uint8_t on = 0;
+
+    for (; p < end; p++, on ^= 1) {
+        if (on)
+            lit += *p;
+        (*runs)++;
+    }
+    return lit;
+}
+
+// Expande o RLE de volta para colunas no formato da tabela
+static int matches(uint8_t k)
+{
+    uint32_t cols[FONT20X28_W] = { 0 };
+    const uint8_t *p = font20x28Rle + font20x28Idx[k];
+    const uint8_t *end = font20x28Rle + font20x28Idx[k + 1];
+    unsigned pos = 0, n;
+    uint8_t on = 0, col;
+
+    for (; p < end; p++, on ^= 1)
+        for (n = *p; n; n--, pos++)
+            if (on)
+                cols[pos / FONT20X28_H] |= 1UL << (FONT20X28_H - 1 - pos % FONT20X28_H);
+    for (col = 0; col < FONT20X28_W; col++)
+        if (cols[col] != font20x28[k][col])
+            return 0;
+    return 1;
+}
+
+static double nsPer(uint32_t (*decode)(uint8_t, uint32_t *), unsigned glyphs)
+{
+    struct timespec t0, t1;
+    uint32_t dummy = 0;
+    unsigned r, k;
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (r = 0; r < REPEAT; r++)
+        for (k = 0; k < FONT20X28_COUNT; k++)
+            if (font20x28Idx[k] != font20x28Idx[k + 1])
+                sink += decode(k, &dummy);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    return ((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec)) / ((double)REPEAT * glyphs);
+}
+
+int main(void)
+{
+    uint32_t shifts = 0, runs = 0;
+    unsigned k, glyphs = 0, bad = 0;
+    unsigned rleBytes = font20x28Idx[FONT20X28_COUNT];
+    IliStats st;
+
+    for (k = 0; k < FONT20X28_COUNT; k++) {
+        if (!matches(k)) {
+            printf("glifo %u ('%c'): RLE diferente da tabela\n", k, FONT20X28_FIRST + k);
+            bad++;
+        }
+        if (font20x28Idx[k] == font20x28Idx[k + 1])
+            continue;
+        if (decodeTable(k, &shifts) != decodeRle(k, &runs))
+            bad++;
+        glyphs++;
+    }
+
+    printf("flash ' '..DEL     tabela %5u bytes   RLE %5u bytes (%u trechos + %u índice)\n",
+           (unsigned)(FONT20X28_COUNT * sizeof(font20x28[0])),
+           (unsigned)(rleBytes + sizeof(font20x28Idx)), rleBytes, (unsigned)sizeof(font20x28Idx));
+    printf("por glifo (%u)     tabela %u testes de bit, %lu passos de shift 32 bits\n"
+           "                   RLE    %.1f trechos lidos (um byte cada)\n",
+           glyphs, FONT20X28_W * FONT20X28_H, (unsigned long)(shifts / glyphs),
+           (double)runs / glyphs);
+    printf("host ns/glifo      tabela %.1f   RLE %.1f\n",
+           nsPer(decodeTable, glyphs), nsPer(decodeRle, glyphs));
+
+    benchBegin();
+    drawString_4x(0, 0, "prato", TFT_BLACK);
+    benchTake(&st);
+    printf("\"prato\" barramento transparente %lu bytes/%lu janelas",
+           (unsigned long)st.bytes, (unsigned long)st.windows);
+    drawString_4xOpaque(0, 40, "prato", TFT_BLACK, TFT_WHITE);
+    benchTake(&st);
+    printf("   opaco %lu bytes/%lu janelas\n", (unsigned long)st.bytes, (unsigned long)st.windows);
+
+    return bad != 0;
+}
@@ -0,0 +1,72 @@
+/// bench-lines.c - Compara o custo no barramento de linhas e contornos
+///
+/// Desenha as mesmas formas com drawHLine/drawVLine/drawFrame e com um laço
+/// de drawPixel, e imprime bytes, bytes por pixel e janelas de cada caso
+/// medidos pelo emulador do ILI9341. Uso: make -C sim bench
+#include <msp430.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "ili9341.h"
+#include "tft-lcd.h"
+#include "bench.h"
+
+typedef struct {
+    const char *name;
+    uint16_t x, y, w, h;
+    uint8_t  frame;         // 1 = apenas o contorno do retângulo
+} Shape;
+
+static const Shape shapes[] = {
+    { "hline 100",    10,  20, 100,   1, 0 },
+    { "hline 320",     0, 120, 320,   1, 0 },
+    { "vline 100",    20,  10,   1, 100, 0 },
+    { "vline 240",   300,   0,   1, 240, 0 },
+    { "frame 100x60", 40,  60, 100,  60, 1 },
+};
+
+static void byPixels(const Shape *s, tft_color_t color)
+{
+    uint16_t i, j;
+
+    for (j = 0; j < s->h; j++)
+        for (i = 0; i < s->w; i++)
+            if (!s->frame || !j || !i || j == s->h - 1 || i == s->w - 1)
+                drawPixel(s->x + i, s->y + j, color);
+}
+
+static void byRuns(const Shape *s, tft_color_t color)
+{
+    if (s->frame)
+        drawFrame(s->x, s->y, s->w, s->h, color);
+    else if (s->h == 1)
+        drawHLine(s->x, s->y, s->w, color);
+    else
+        drawVLine(s->x, s->y, s->h, color);
+}
+
+static void report(const char *name, const char *how)
+{
+    IliStats st;
+
+    benchTake(&st);
+    printf("%-14s %-9s %8lu %8lu %10.2f %8lu\n", name, how,
+           (unsigned long)st.pixels, (unsigned long)st.bytes,
+           st.pixels ? (double)st.bytes / st.pixels : 0.0,
+           (unsigned long)st.windows);
+}
+
+int main(void)
+{
+    unsigned i;
+
+    benchBegin();
+    printf("%-14s %-9s %8s %8s %10s %8s\n",
+           "forma", "metodo", "pixels", "bytes", "bytes/px", "janelas");
+    for (i = 0; i < sizeof(shapes) / sizeof(shapes[0]); i++) {
+        byPixels(&shapes[i], TFT_RED);
+        report(shapes[i].name, "drawPixel");
+        byRuns(&shapes[i], TFT_BLUE);
+        report(shapes[i].name, "linhas");
+    }
+    return 0;
+}
@@ -0,0 +1,43 @@
+/// bench-prop.c - Texto de largura fixa (font5x7) x proporcional com kerning
+///
+/// Para cada texto das telas imprime a largura em células fixas de 6 pixels
+/// e em font5x7Prop (measureString), e os bytes no barramento do texto opaco
+/// com drawStringLine e drawStringProp medidos pelo emulador do ILI9341.
+/// Uso: make -C sim bench
+#include <msp430.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "ili9341.h"
+#include "tft-lcd.h"
+#include "bench.h"
+#include "fonts.h"
+
+static const char * const texts[] = {
+    "PRATO PRINCIPAL",
+    "Isca de Frango acebolada",
+    "Contem: Leite e derivados",
+    "Sopa de cenoura com curry e leite de coco",
+    "Valor Cal: 60kCal",
+    "Porcao: 200g",
+};
+
+int main(void)
+{
+    unsigned i, n;
+    IliStats fixed, prop;
+
+    benchBegin();
+
+    printf("%-42s %6s %6s %9s %9s\n", "string", "fixa", "prop", "bytes.fix", "bytes.prop");
+    for (i = 0; i < sizeof(texts) / sizeof(texts[0]); i++) {
+        for (n = 0; texts[i][n]; n++)
+            ;
+        drawStringLine(0, 100, texts[i], TFT_BLACK, TFT_WHITE);
+        benchTake(&fixed);
+        drawStringProp(0, 120, texts[i], &font5x7Prop, TFT_BLACK, TFT_WHITE);
+        benchTake(&prop);
+        printf("%-42s %6u %6u %9lu %9lu\n", texts[i], n * 6,
+               measureString(texts[i], &font5x7Prop), (unsigned long)fixed.bytes, (unsigned long)prop.bytes);
+    }
+    return 0;
+}
@@ -0,0 +1,123 @@
+/// bench-text.c - Janelas e bytes do texto transparente por string
+///
+/// Para cada string desenha o texto pixel a pixel (drawPixel por bit aceso,
+/// como o renderizador antigo) e com drawString/drawString_4x, que agrupa os
+/// bits em trechos e retângulos, e imprime janelas e bytes antes e depois
+/// medidos pelo emulador do ILI9341. As duas versões são desenhadas no mesmo
+/// lugar sobre a tela limpa e a imagem do emulador tem de ser idêntica; uma
+/// diferença encerra o benchmark com erro. Uso: make -C sim bench
+#include <msp430.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "ili9341.h"
+#include "tft-lcd.h"
+#include "bench.h"
+#include "fonts.h"
+
+typedef struct {
+    const char *str;
+    uint8_t     big;        // 1 = fonte 20x28 (drawString_4x)
+} Text;
+
+static const Text texts[] = {
+    { "PRATO PRINCIPAL",           0 },
+    { "Isca de Frango acebolada",  0 },
+    { "Valor Cal: 60kCal",         0 },
+    { "Porcao: 200g",              0 },
+    { "xyz",                       1 },
+};
+
+#define X0 10
+#define Y0 40
+
+static uint8_t ref[ILI_GRAM_COLS][ILI_GRAM_ROWS][3];   // Imagem do renderizador antigo
+
+static void clear(void)
+{
+    IliStats st;
+
+    fillRect(0, 0, ILI_GRAM_ROWS, ILI_GRAM_COLS, TFT_WHITE);
+    benchTake(&st);         // A limpeza não entra na medida
+}
+
+static void snapshot(uint8_t img[ILI_GRAM_COLS][ILI_GRAM_ROWS][3])
+{
+    uint16_t x, y;
+
+    for (y = 0; y < ILI_GRAM_COLS; y++)
+        for (x = 0; x < ILI_GRAM_ROWS; x++)
+            memcpy(img[y][x], iliPixel(x, y), 3);
+}
+
+// Primeiro pixel diferente da imagem de referência, ou 0
+static int differs(uint16_t *dx, uint16_t *dy)
+{
+    uint16_t x, y;
+
+    for (y = 0; y < ILI_GRAM_COLS; y++)
+        for (x = 0; x < ILI_GRAM_ROWS; x++)
+            if (memcmp(ref[y][x], iliPixel(x, y), 3)) {
+                *dx = x;
+                *dy = y;
+                return 1;
+            }
+    return 0;
+}
+
+static void byPixels(uint16_t x, uint16_t y, const Text *t)
+{
+    const char *p;
+    uint8_t col, row;
+
+    for (p = t->str; *p; p++) {
+        if (t->big) {
+            for (col = 0; col < 20; col++)
+                for (row = 0; row < 28; row++)
+                    if (font20x28[*p - 32][col] & (1UL << (27 - row)))
+                        drawPixel(x + col, y + row, TFT_BLACK);
+            x += 21;
+        } else {
+            for (col = 0; col < 5; col++)
+                for (row = 0; row < 8; row++)
+                    if (FONT5X7(*p)[col] & (1 << row))
+                        drawPixel(x + col, y + row, TFT_BLACK);
+            x += 6;
+        }
+    }
+}
+
+int main(void)
+{
+    IliStats before, after;
+    uint16_t dx, dy;
+    unsigned i;
+
+    benchBegin();
+
+    printf("%-26s %7s %9s %9s %9s %9s\n",
+           "string", "pixels", "jan.antes", "jan.depois", "bytes.ant", "bytes.dep");
+    for (i = 0; i < sizeof(texts) / sizeof(texts[0]); i++) {
+        const Text *t = &texts[i];
+
+        clear();
+        byPixels(X0, Y0, t);
+        benchTake(&before);
+        snapshot(ref);
+        clear();
+        if (t->big)
+            drawString_4x(X0, Y0, t->str, TFT_BLACK);
+        else
+            drawString(X0, Y0, t->str, TFT_BLACK);
+        benchTake(&after);
+        if (differs(&dx, &dy)) {
+            printf("%s: imagem diferente do pixel a pixel em (%u, %u)\n", t->str, dx, dy);
+            return 1;
+        }
+        printf("%-26s %7lu %9lu %9lu %9lu %9lu\n", t->str,
+               (unsigned long)after.pixels,
+               (unsigned long)before.windows, (unsigned long)after.windows,
+               (unsigned long)before.bytes, (unsigned long)after.bytes);
+    }
+    return 0;
+}
@@ -0,0 +1,23 @@
+/// bench.c - Preparação e medida comuns aos benchmarks
+#include <msp430.h>
+#include "ili9341.h"
+#include "tft-lcd.h"
+#include "time-ctrl.h"
+#include "bench.h"
+
+void benchBegin(void)
+{
+    IliStats st;
+
+    timeConfig();
+    tftConfig();
+    while (!tftInitPoll())
+        ;                   // Display pronto antes das medidas
+    benchTake(&st);         // Descarta a sequência de inicialização
+}
+
+void benchTake(IliStats *st)
+{
+    tftFlush();
+    iliTakeStats(st);
+}
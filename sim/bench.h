@@ -0,0 +1,15 @@
+/// bench.h - Preparação e medida comuns aos benchmarks (make -C sim bench)
+#ifndef __BENCH_H
+#define __BENCH_H
+
+#include "ili9341.h"
+
+// Configura o timer e o display, espera a inicialização terminar e descarta
+// os contadores dela: a primeira medida começa do zero
+void benchBegin(void);
+
+// Esvazia a fila de transmissão e lê (zerando) os contadores do emulador
+// desde a medida anterior
+void benchTake(IliStats *st);
+
+#endif // __BENCH_H
@@ -0,0 +1,81 @@
+/// fontaa.c - Gera fonts-aa.c: fonte anti-aliased 12x24 de 2 bits por pixel
+///
+/// Reduz cada glifo ' '..'~' da Font48 (24x48, 1 bit por pixel) pela metade
+/// nos dois eixos: cada bloco de 2x2 pixels vira um pixel com o nível de
+/// cobertura (0..4 pixels acesos) arredondado para 0..3, no formato de AAFont
+/// em fonts.h. Uso: fontaa -o ../fonts-aa.c
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "fonts.h"
+#include "_fonts/fonts.h"
+
+#define FIRST   ' '
+#define COUNT   95                      // ' '..'~'
+#define SRC     Font48
+#define W       (24 / 2)
+#define H       (48 / 2)
+#define STRIDE  ((W + 3) / 4)
+#define GLYPH   (H * STRIDE)
+
+static uint8_t table[COUNT * GLYPH];
+
+static int srcBit(unsigned k, unsigned x, unsigned y)
+{
+    unsigned stride = (SRC.Width + 7) / 8;
+    const uint8_t *line = SRC.table + (k * SRC.Height + y) * stride;
+
+    return (line[x / 8] >> (7 - x % 8)) & 1;
+}
+
+int main(int argc, char **argv)
+{
+    const char *outPath = argc == 3 && !strcmp(argv[1], "-o") ? argv[2] : 0;
+    unsigned k, x, y, i, cover, level, hist[4] = { 0 };
+    uint8_t *g;
+    FILE *out;
+
+    if (!outPath) {
+        fprintf(stderr, "uso: %s -o saida.c\n", argv[0]);
+        return 2;
+    }
+    for (k = 0; k < COUNT; k++) {
+        g = table + k * GLYPH;
+        for (y = 0; y < H; y++)
+            for (x = 0; x < W; x++) {
+                cover = srcBit(k, 2 * x, 2 * y) + srcBit(k, 2 * x + 1, 2 * y)
+                      + srcBit(k, 2 * x, 2 * y + 1) + srcBit(k, 2 * x + 1, 2 * y + 1);
+                level = (cover * 3 + 2) / 4;    // 0, 1, 2, 2, 3
+                hist[level]++;
+                g[y * STRIDE + x / 4] |= level << (6 - 2 * (x % 4));
+            }
+    }
+
+    if (!(out = fopen(outPath, "w"))) {
+        perror(outPath);
+        return 1;
+    }
+    fprintf(out, "/// fonts-aa.c - Fonte anti-aliased %ux%u, 2 bits por pixel (formato em fonts.h)\n"
+                 "///\n"
+                 "/// Gerado por sim/fontaa (make -C sim aa) a partir da Font48 em\n"
+                 "/// _fonts/font48.c. Não editar à mão.\n"
+                 "#include <stdint.h>\n#include \"fonts.h\"\n\n"
+                 "#if !FONT_SUBSET\n\n"
+                 "static const uint8_t fontAA24Table[%u] = {\n", W, H, COUNT * GLYPH);
+    for (k = 0; k < COUNT; k++) {
+        fprintf(out, "    ");
+        for (i = 0; i < GLYPH; i++)
+            fprintf(out, "0x%02X,%s", table[k * GLYPH + i],
+                    i + 1 == GLYPH ? "" : i % 18 == 17 ? "\n    " : "");
+        if (FIRST + k == '\\')
+            fprintf(out, "  // barra invertida\n");
+        else
+            fprintf(out, "  // '%c'\n", FIRST + k);
+    }
+    fprintf(out, "};\n\nconst AAFont fontAA24 = { fontAA24Table, %u, %u, 0 };\n\n"
+                 "#endif // !FONT_SUBSET\n", W, H);
+    fclose(out);
+    fprintf(stderr, "fontAA24: %u bytes; pixels por nível 0/1/2/3: %u/%u/%u/%u\n",
+            COUNT * GLYPH, hist[0], hist[1], hist[2], hist[3]);
+    return 0;
+}
@@ -0,0 +1,139 @@
+/// fontprop.c - Gera fonts-prop.c: a font5x7 proporcional, com kerning
+///
+/// Corta cada glifo ' '..0xFF (Latin-1) da font5x7 às colunas acesas (o
+/// espaço fica com PROP_SPACE colunas vazias) e grava as colunas em sequência
+/// com a tabela de início de cada glifo, no formato de PropFont em fonts.h.
+/// Um par de letras ASCII recebe kerning de -1 quando a coluna de um dos
+/// lados que fica de frente para o outro tem um único pixel aceso e os dois
+/// glifos, sem a coluna de espaçamento, não se tocam nem na diagonal.
+/// Uso: fontprop -o ../fonts-prop.c
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "fonts.h"
+
+#define FIRST       ' '
+#define COUNT       FONT5X7_MAP         // ' '..0xFF
+#define PROP_SPACE  2                   // Largura do espaço, sem o espaçamento
+
+static uint8_t  cols[COUNT * 5 + PROP_SPACE];
+static uint16_t offset[COUNT + 1];
+static uint16_t kernIdx[COUNT + 1];
+static uint8_t  kernRight[COUNT * COUNT];
+
+// Escreve c (Latin-1) em UTF-8; controles como código hexadecimal
+static void putLatin1(FILE *out, int c)
+{
+    if (c < 0x7F)
+        fprintf(out, "'%c'", c);
+    else if (c < 0xA0)
+        fprintf(out, "0x%02X", c);
+    else
+        fprintf(out, "'%c%c'", 0xC0 | c >> 6, 0x80 | (c & 0x3F));
+}
+
+static int bits(uint8_t v)
+{
+    int n = 0;
+
+    for (; v; v >>= 1)
+        n += v & 1;
+    return n;
+}
+
+static int kerns(int a, int b)
+{
+    uint8_t l, f;
+
+    if (a >= 0x7F || b >= 0x7F || !isalpha(a) || !isalpha(b))
+        return 0;
+    l = cols[offset[a - FIRST + 1] - 1];    // Última coluna de a
+    f = cols[offset[b - FIRST]];            // Primeira coluna de b
+    return !((l | l << 1 | l >> 1) & f) && (bits(l) == 1 || bits(f) == 1);
+}
+
+int main(int argc, char **argv)
+{
+    const char *outPath = argc == 3 && !strcmp(argv[1], "-o") ? argv[2] : 0;
+    unsigned k, b, c, n = 0, nKern = 0, i;
+    int first, last;
+    FILE *out;
+
+    if (!outPath) {
+        fprintf(stderr, "uso: %s -o saida.c\n", argv[0]);
+        return 2;
+    }
+    for (k = 0; k < COUNT; k++) {
+        const uint8_t *g = FONT5X7(FIRST + k);
+
+        offset[k] = n;
+        for (first = -1, last = -1, c = 0; c < 5; c++)
+            if (g[c]) {
+                if (first < 0)
+                    first = c;
+                last = c;
+            }
+        if (first < 0)
+            for (c = 0; c < PROP_SPACE; c++)
+                cols[n++] = 0;
+        else
+            for (c = first; c <= (unsigned)last; c++)
+                cols[n++] = g[c];
+    }
+    offset[k] = n;
+    for (k = 0; k < COUNT; k++) {
+        kernIdx[k] = nKern;
+        for (b = 0; b < COUNT; b++)
+            if (kerns(FIRST + k, FIRST + b))
+                kernRight[nKern++] = FIRST + b;
+    }
+    kernIdx[k] = nKern;
+
+    if (!(out = fopen(outPath, "w"))) {
+        perror(outPath);
+        return 1;
+    }
+    fprintf(out, "/// fonts-prop.c - font5x7 proporcional com kerning (formato em fonts.h)\n"
+                 "///\n"
+                 "/// Gerado por sim/fontprop (make -C sim prop) a partir de font5x7 em\n"
+                 "/// fonts.c. Não editar à mão.\n"
+                 "#include <stdint.h>\n#include \"fonts.h\"\n\n"
+                 "static const uint8_t propCols[%u] = {\n", n);
+    for (k = 0; k < COUNT; k++) {
+        fprintf(out, "    ");
+        for (i = offset[k]; i < offset[k + 1]; i++)
+            fprintf(out, "0x%02X, ", cols[i]);
+        fprintf(out, "%*s// ", 6 * (5 - (offset[k + 1] - offset[k])), "");
+        if (FIRST + k == '\\')
+            fprintf(out, "barra invertida");
+        else
+            putLatin1(out, FIRST + k);
+        fprintf(out, "\n");
+    }
+    fprintf(out, "};\n\nstatic const uint16_t propOffset[%u] = {", COUNT + 1);
+    for (i = 0; i <= COUNT; i++)
+        fprintf(out, "%s%3u,", i % 16 ? " " : "\n    ", offset[i]);
+    fprintf(out, "\n};\n\nstatic const uint16_t propKernIdx[%u] = {", COUNT + 1);
+    for (i = 0; i <= COUNT; i++)
+        fprintf(out, "%s%3u,", i % 16 ? " " : "\n    ", kernIdx[i]);
+    fprintf(out, "\n};\n\n// Pares com kerning de -1, agrupados pelo caractere da esquerda\n"
+                 "static const KernPair propKern[%u] = {\n", nKern ? nKern : 1);
+    for (k = 0; k < COUNT; k++) {
+        if (kernIdx[k] == kernIdx[k + 1])
+            continue;
+        fprintf(out, "    ");
+        for (i = kernIdx[k]; i < kernIdx[k + 1]; i++)
+            fprintf(out, "{'%c',-1},%s", kernRight[i],
+                    i + 1 < kernIdx[k + 1] && (i - kernIdx[k]) % 8 == 7 ? "\n    " : " ");
+        fprintf(out, " // '%c'\n", FIRST + k);
+    }
+    fprintf(out, "};\n\nconst PropFont font5x7Prop = {\n"
+                 "    propCols, propOffset, propKernIdx, propKern, '%c', %u, 1\n};\n",
+            FIRST, COUNT);
+    fclose(out);
+    fprintf(stderr, "font5x7Prop: %u colunas (%u na tabela fixa), %u pares de kerning, %u bytes\n",
+            n, COUNT * 5, nKern,
+            (unsigned)(n + sizeof(offset) + sizeof(kernIdx) + nKern * 2));
+    return 0;
+}
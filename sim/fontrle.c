@@ -0,0 +1,89 @@
+/// fontrle.c - Gera fonts-rle.c: a fonte 20x28 de fonts.c codificada em RLE
+///
+/// Percorre cada glifo ' '..DEL da tabela font20x28 (uint32_t por coluna,
+/// bit 27 = linha de cima) coluna a coluna, de cima para baixo, e grava os
+/// comprimentos dos trechos alternados de fundo e frente, um byte por trecho,
+/// no formato descrito em fonts.h. Uso: fontrle -o ../fonts-rle.c
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "fonts.h"
+
+static uint8_t  rle[FONT20X28_COUNT * FONT20X28_W * FONT20X28_H];
+static uint16_t idx[FONT20X28_COUNT + 1];
+
+// Acrescenta um trecho, dividindo-o com trechos vazios acima de 255
+static unsigned put(unsigned n, unsigned len)
+{
+    while (len > 255) {
+        rle[n++] = 255;
+        rle[n++] = 0;
+        len -= 255;
+    }
+    rle[n++] = len;
+    return n;
+}
+
+int main(int argc, char **argv)
+{
+    const char *outPath = argc == 3 && !strcmp(argv[1], "-o") ? argv[2] : 0;
+    unsigned k, col, row, n = 0, run, i;
+    uint8_t on, bit;
+    FILE *out;
+
+    if (!outPath) {
+        fprintf(stderr, "uso: %s -o saida.c\n", argv[0]);
+        return 2;
+    }
+    for (k = 0; k < FONT20X28_COUNT; k++) {
+        idx[k] = n;
+        on  = 0;
+        run = 0;
+        for (col = 0; col < FONT20X28_W; col++) {
+            for (row = 0; row < FONT20X28_H; row++) {
+                bit = (font20x28[k][col] >> (FONT20X28_H - 1 - row)) & 1;
+                if (bit != on) {
+                    n = put(n, run);
+                    on  = bit;
+                    run = 0;
+                }
+                run++;
+            }
+        }
+        if (on)                         // O fundo final fica implícito
+            n = put(n, run);
+    }
+    idx[k] = n;
+
+    if (!(out = fopen(outPath, "w"))) {
+        perror(outPath);
+        return 1;
+    }
+    fprintf(out, "/// fonts-rle.c - Fonte 20x28 em RLE (formato em fonts.h)\n"
+                 "///\n"
+                 "/// Gerado por sim/fontrle (make -C sim rle) a partir de font20x28 em\n"
+                 "/// fonts.c. Não editar à mão.\n"
+                 "#include <stdint.h>\n#include \"fonts.h\"\n\n"
+                 "const uint16_t font20x28Idx[FONT20X28_COUNT + 1] = {");
+    for (i = 0; i <= FONT20X28_COUNT; i++)
+        fprintf(out, "%s%4u,", i % 12 ? " " : "\n    ", idx[i]);
+    fprintf(out, "\n};\n\nconst uint8_t font20x28Rle[%u] = {\n", n ? n : 1);
+    for (k = 0; k < FONT20X28_COUNT; k++) {
+        if (idx[k] == idx[k + 1])
+            continue;                   // Glifo vazio: nenhum byte
+        fprintf(out, "    ");
+        for (i = idx[k]; i < idx[k + 1]; i++)
+            fprintf(out, "%u,%s", rle[i],
+                    i + 1 < idx[k + 1] && (i - idx[k]) % 24 == 23 ? "\n    " : " ");
+        if (FONT20X28_FIRST + k == '\\')
+            fprintf(out, " // barra invertida\n");
+        else
+            fprintf(out, " // '%c'\n", FONT20X28_FIRST + k < 127 ? FONT20X28_FIRST + k : '?');
+    }
+    fprintf(out, "};\n");
+    fclose(out);
+    fprintf(stderr, "font20x28: %u -> %u bytes (%u de trechos + %u de índice)\n",
+            (unsigned)(FONT20X28_COUNT * FONT20X28_W * sizeof(uint32_t)),
+            (unsigned)(n + sizeof(idx)), n, (unsigned)sizeof(idx));
+    return 0;
+}
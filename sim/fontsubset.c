@@ -0,0 +1,270 @@
+/// fontsubset.c - Gera fonts-subset.c só com os glifos usados pelas telas
+///
+/// Lê os textos das telas (literais "..." e '.' de arquivos .c/.h, ou todas
+/// as linhas de um manifesto em qualquer outro arquivo), decodificados de
+/// UTF-8 para Latin-1 com utf8Next, junta o conjunto de caracteres e grava,
+/// para a font5x7, apenas esses glifos mais um mapa de 224 bytes (' '..0xFF
+/// -> índice no subconjunto) e, para cada tabela sFONT, os glifos ASCII mais
+/// um mapa de 95 bytes (' '..'~'), o mesmo usado pela fonte anti-aliased.
+/// Caracteres fora do subconjunto caem no índice 0, que é sempre o espaço.
+/// Uso: fontsubset -o ../fonts-subset.c ../main.c [manifesto.txt ...]
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fonts.h"
+#include "_fonts/fonts.h"
+
+#define FIRST   ' '
+#define COUNT   95                      // ' '..'~' (tabelas sFONT)
+#define LATIN   FONT5X7_MAP             // ' '..0xFF (font5x7)
+#define LIT_MAX 256                     // Bytes por literal
+
+typedef struct {
+    const char *name;
+    const sFONT *font;
+} Named;
+
+static const Named sfonts[] = {
+    { "Font8",  &Font8  }, { "Font12", &Font12 }, { "Font16", &Font16 },
+    { "Font20", &Font20 }, { "Font24", &Font24 }, { "Font32", &Font32 },
+    { "Font48", &Font48 },
+};
+
+static uint8_t used[LATIN];             // Caracteres pedidos pelos textos
+static uint8_t map[LATIN];              // Índice de cada caractere no subconjunto
+static uint8_t nUsed, nAscii;
+
+// Marca os caracteres de um texto UTF-8 (ou Latin-1) de n bytes
+static void use(const char *text, unsigned n)
+{
+    char buf[LIT_MAX + 1];
+    const char *p = buf;
+    uint8_t c;
+
+    memcpy(buf, text, n);
+    buf[n] = 0;
+    while (*p) {
+        c = utf8Next(&p);
+        if (c >= FIRST)
+            used[c - FIRST] = 1;
+    }
+}
+
+// Escreve c (Latin-1) em UTF-8; controles viram '?'
+static void putLatin1(FILE *out, int c)
+{
+    if (c < 0x80)
+        fputc(c, out);
+    else if (c < 0xA0)
+        fputc('?', out);
+    else
+        fprintf(out, "%c%c", 0xC0 | c >> 6, 0x80 | (c & 0x3F));
+}
+
+static int isSource(const char *path)
+{
+    const char *dot = strrchr(path, '.');
+
+    return dot && (!strcmp(dot, ".c") || !strcmp(dot, ".h"));
+}
+
+// Literais de string e de caractere de um fonte C, ignorando comentários e
+// diretivas do pré-processador (#include "...")
+static void scanSource(FILE *f)
+{
+    int c, quote = 0, prev = 0, bol = 1;
+    char lit[LIT_MAX];
+    unsigned n = 0;
+
+    while ((c = getc(f)) != EOF) {
+        if (!quote) {
+            if (bol && c == '#') {
+                while ((c = getc(f)) != EOF && c != '\n')
+                    ;
+            }
+            if (c == '\n')
+                bol = 1;
+            else if (c != ' ' && c != '\t')
+                bol = 0;
+            if (prev == '/' && c == '/') {
+                while ((c = getc(f)) != EOF && c != '\n')
+                    ;
+            } else if (prev == '/' && c == '*') {
+                for (prev = 0; (c = getc(f)) != EOF; prev = c)
+                    if (prev == '*' && c == '/')
+                        break;
+                c = 0;
+            } else if (c == '"' || c == '\'') {
+                quote = c;
+                n = 0;
+            }
+            prev = c;
+            continue;
+        }
+        if (c == quote) {
+            quote = 0;
+            use(lit, n);
+        } else if (c == '\\') {
+            c = getc(f);
+            if (c == 'x') {
+                int v = 0, d;
+                while ((d = getc(f)) != EOF && strchr("0123456789abcdefABCDEF", d))
+                    v = v * 16 + (d <= '9' ? d - '0' : (d | 0x20) - 'a' + 10);
+                if (d != EOF)
+                    ungetc(d, f);
+                c = v;
+            }                           // \" \\ \' ; \n e afins não têm glifo
+            if (n < LIT_MAX && c)
+                lit[n++] = c;
+        } else if (n < LIT_MAX) {
+            lit[n++] = c;
+        }
+        prev = 0;
+    }
+}
+
+static void scanManifest(FILE *f)
+{
+    char line[LIT_MAX];
+
+    while (fgets(line, sizeof(line), f))
+        use(line, strlen(line));
+}
+
+static void emitMap(FILE *out, const char *name, const uint8_t *m, int count)
+{
+    int i;
+
+    fprintf(out, "const uint8_t %s[%d] = {", name, count);
+    for (i = 0; i < count; i++)
+        fprintf(out, "%s%2u,", i % 16 ? " " : "\n    ", m[i]);
+    fprintf(out, "\n};\n\n");
+}
+
+// Um glifo por linha (quebrada a cada 16 bytes); rows = 1 envolve o glifo
+// em chaves, para tabelas de duas dimensões
+static void emitBytes(FILE *out, const uint8_t *p, unsigned n, int c, int rows)
+{
+    unsigned i;
+
+    fprintf(out, rows ? "    {" : "    ");
+    for (i = 0; i < n; i++)
+        fprintf(out, "0x%02X%s", p[i],
+                i + 1 == n ? (rows ? "}," : ",") : (i % 16) == 15 ? ",\n    " : ",");
+    if (c == '\\') {
+        fprintf(out, "  // barra invertida\n");    // '\\' no fim do comentário emendaria a linha
+    } else {
+        fprintf(out, "  // '");
+        putLatin1(out, c);
+        fprintf(out, "'\n");
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const char *outPath = 0;
+    FILE *out, *f;
+    unsigned i, k, full, sub, total = 0, totalFull = 0;
+    uint8_t asciiMap[COUNT];            // ' '..'~' -> índice nas tabelas sFONT
+
+    for (i = 1; i < (unsigned)argc; i++) {
+        if (!strcmp(argv[i], "-o") && i + 1 < (unsigned)argc) {
+            outPath = argv[++i];
+            continue;
+        }
+        if (!(f = fopen(argv[i], "r"))) {
+            perror(argv[i]);
+            return 1;
+        }
+        if (isSource(argv[i]))
+            scanSource(f);
+        else
+            scanManifest(f);
+        fclose(f);
+    }
+    if (!outPath) {
+        fprintf(stderr, "uso: %s -o saida.c textos.c|manifesto ...\n", argv[0]);
+        return 2;
+    }
+
+    used[0] = 1;                        // O espaço é o índice 0 (substituto)
+    for (i = 0; i < LATIN; i++)
+        map[i] = used[i] ? nUsed++ : 0;
+    for (i = 0; i < COUNT; i++)
+        asciiMap[i] = used[i] ? nAscii++ : 0;
+
+    if (!(out = fopen(outPath, "w"))) {
+        perror(outPath);
+        return 1;
+    }
+    fprintf(out, "/// fonts-subset.c - Subconjunto das fontes com os glifos usados pelas telas\n"
+                 "///\n"
+                 "/// Gerado por sim/fontsubset (make -C sim subset) a partir de:\n///  ");
+    for (i = 1; i < (unsigned)argc; i++)
+        if (strcmp(argv[i], "-o") && (i == 1 || strcmp(argv[i - 1], "-o")))
+            fprintf(out, " %s", argv[i]);
+    fprintf(out, "\n/// Não editar à mão. Só é compilado com FONT_SUBSET = 1, que tira as\n"
+                 "/// tabelas completas do build.\n"
+                 "#include <stdint.h>\n#include \"fonts.h\"\n#include \"_fonts/fonts.h\"\n\n"
+                 "#if FONT_SUBSET\n\n// %u glifos: \"", nUsed);
+    for (i = 0; i < LATIN; i++)
+        if (used[i])
+            putLatin1(out, FIRST + i == '"' || FIRST + i == '\\' ? '?' : FIRST + i);
+    fprintf(out, "\"\n\n");
+
+    emitMap(out, "font5x7Map", map, LATIN);
+    fprintf(out, "const uint8_t font5x7[][5] = {\n");
+    for (i = 0; i < LATIN; i++)
+        if (used[i])
+            emitBytes(out, FONT5X7(FIRST + i), 5, FIRST + i, 1);
+    fprintf(out, "};\n\n");
+    for (full = 0x100, i = 0; i < 96; i++)  // Tabela CP437 e acentos acrescentados
+        if (font5x7Latin1[i] >= full)
+            full = font5x7Latin1[i] + 1;
+    full = full * 5 + sizeof(font5x7Latin1);
+    sub  = LATIN + nUsed * 5;
+    fprintf(stderr, "%-8s %6u -> %6u bytes\n", "font5x7", full, sub);
+    total += sub;
+    totalFull += full;
+
+    for (k = 0; k < sizeof(sfonts) / sizeof(sfonts[0]); k++) {
+        const sFONT *ft = sfonts[k].font;
+        unsigned glyph = ft->Height * ((ft->Width + 7) / 8);
+        char name[32];
+
+        snprintf(name, sizeof(name), "%s_Map", sfonts[k].name);
+        fprintf(out, "static ");
+        emitMap(out, name, asciiMap, COUNT);
+        fprintf(out, "static const uint8_t %s_Table[] = {\n", sfonts[k].name);
+        for (i = 0; i < COUNT; i++)
+            if (used[i])
+                emitBytes(out, ft->table + i * glyph, glyph, FIRST + i, 0);
+        fprintf(out, "};\n\nsFONT %s = { %s_Table, %u, %u, %s_Map };\n\n",
+                sfonts[k].name, sfonts[k].name, ft->Width, ft->Height, sfonts[k].name);
+        full = COUNT * glyph;
+        sub  = COUNT + nAscii * glyph;
+        fprintf(stderr, "%-8s %6u -> %6u bytes\n", sfonts[k].name, full, sub);
+        total += sub;
+        totalFull += full;
+    }
+    {
+        unsigned glyph = fontAA24.height * ((fontAA24.width + 3) / 4);
+
+        fprintf(out, "static const uint8_t fontAA24Table[] = {\n");
+        for (i = 0; i < COUNT; i++)
+            if (used[i])
+                emitBytes(out, fontAA24.table + i * glyph, glyph, FIRST + i, 0);
+        fprintf(out, "};\n\nconst AAFont fontAA24 = { fontAA24Table, %u, %u, Font48_Map };\n\n",
+                fontAA24.width, fontAA24.height);
+        full = COUNT * glyph;
+        sub  = nAscii * glyph;          // O mapa é o da Font48
+        fprintf(stderr, "%-8s %6u -> %6u bytes\n", "fontAA24", full, sub);
+        total += sub;
+        totalFull += full;
+    }
+    fprintf(out, "#endif // FONT_SUBSET\n");
+    fclose(out);
+    fprintf(stderr, "%u glifos; total %u -> %u bytes\n", nUsed, totalFull, total);
+    return 0;
+}
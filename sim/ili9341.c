@@ -0,0 +1,219 @@
+/// ili9341.c - Emulador bit a bit do ILI9341 alimentado pelos bytes da USCI_B0
+///
+/// Decodifica CASET (0x2A), PASET (0x2B), RAMWR (0x2C), RAMWRC (0x3C),
+/// MADCTL (0x36) e COLMOD (0x3A) numa GRAM de 240x320 e contabiliza o tráfego
+/// do barramento. Os demais comandos têm os parâmetros consumidos e ignorados.
+#include <stdio.h>
+#include <string.h>
+#include "ili9341.h"
+
+#define MADCTL_MY   0x80
+#define MADCTL_MX   0x40
+#define MADCTL_MV   0x20
+
+static uint8_t gram[ILI_GRAM_COLS][ILI_GRAM_ROWS][3];
+
+static struct {
+    uint8_t  cs, dc, rst;           // Nível atual dos pinos
+    uint8_t  cmd;                   // Último comando recebido
+    uint8_t  nArg;                  // Parâmetros recebidos do comando atual
+    uint8_t  arg[4];
+    uint8_t  madctl, colmod;
+    uint16_t sc, ec, sp, ep;        // Janela de endereços
+    uint16_t col, page;             // Ponteiro de escrita
+    uint8_t  px[3];                 // Bytes do pixel em montagem
+    uint8_t  nPx;
+    uint8_t  windowUsed;            // Janela atual já recebeu pixels
+    IliStats st;
+} ili = { .cs = 1, .dc = 1, .rst = 1 };
+
+void iliReset(void)
+{
+    IliStats st = ili.st;
+
+    memset(gram, 0, sizeof(gram));
+    memset(&ili, 0, sizeof(ili));
+    ili.st     = st;
+    ili.cs     = 1;
+    ili.dc     = 1;
+    ili.rst    = 1;
+    ili.colmod = 0x66;             // Valor padrão após reset: 18 bits/pixel
+    ili.ec     = ILI_GRAM_COLS - 1;
+    ili.ep     = ILI_GRAM_ROWS - 1;
+}
+
+void iliPins(uint8_t cs, uint8_t dc, uint8_t rst)
+{
+    if (cs != ili.cs)
+        ili.st.csToggles++;
+    if (dc != ili.dc)
+        ili.st.dcToggles++;
+    if (!rst && ili.rst)
+        iliReset();                // Borda de descida no RST reinicia o controlador
+    ili.cs  = cs;
+    ili.dc  = dc;
+    ili.rst = rst;
+}
+
+static void storePixel(void)
+{
+    uint8_t  r, g, b;
+    uint16_t gc, gr, maxCol, maxPage;
+
+    if (ili.colmod == 0x55) {      // RGB565: RRRRRGGG GGGBBBBB
+        r = ili.px[0] & 0xF8;
+        g = (uint8_t)((ili.px[0] << 5) | ((ili.px[1] >> 3) & 0x1C));
+        b = (uint8_t)(ili.px[1] << 3);
+    } else {                       // RGB666: 6 bits mais significativos de cada byte
+        r = ili.px[0] & 0xFC;
+        g = ili.px[1] & 0xFC;
+        b = ili.px[2] & 0xFC;
+    }
+
+    maxCol  = (ili.madctl & MADCTL_MV) ? ILI_GRAM_ROWS : ILI_GRAM_COLS;
+    maxPage = (ili.madctl & MADCTL_MV) ? ILI_GRAM_COLS : ILI_GRAM_ROWS;
+
+    if (ili.col < maxCol && ili.page < maxPage) {
+        // Endereço lógico (coluna, página) para a posição física na GRAM
+        if (ili.madctl & MADCTL_MV) {
+            gc = (ili.madctl & MADCTL_MX) ? ILI_GRAM_COLS - 1 - ili.page : ili.page;
+            gr = (ili.madctl & MADCTL_MY) ? ILI_GRAM_ROWS - 1 - ili.col  : ili.col;
+        } else {
+            gc = (ili.madctl & MADCTL_MX) ? ILI_GRAM_COLS - 1 - ili.col  : ili.col;
+            gr = (ili.madctl & MADCTL_MY) ? ILI_GRAM_ROWS - 1 - ili.page : ili.page;
+        }
+        gram[gc][gr][0] = r;
+        gram[gc][gr][1] = g;
+        gram[gc][gr][2] = b;
+        ili.st.pixels++;
+    } else {
+        ili.st.clipped++;
+    }
+
+    if (!ili.windowUsed) {
+        ili.windowUsed = 1;
+        ili.st.windows++;
+    }
+
+    // A coluna avança primeiro; ao fim da página volta ao início da janela
+    if (ili.col >= ili.ec) {
+        ili.col = ili.sc;
+        ili.page = (ili.page >= ili.ep) ? ili.sp : ili.page + 1;
+    } else {
+        ili.col++;
+    }
+}
+
+static void command(uint8_t cmd)
+{
+    ili.cmd  = cmd;
+    ili.nArg = 0;
+    ili.nPx  = 0;
+
+    switch (cmd) {
+    case 0x01:                     // Software reset
+        iliReset();
+        break;
+    case 0x2C:                     // Memory Write: reinicia no canto da janela
+        ili.col  = ili.sc;
+        ili.page = ili.sp;
+        ili.st.ramwr++;
+        break;
+    case 0x3C:                     // Memory Write Continue: mantém o ponteiro
+        ili.st.ramwr++;
+        break;
+    }
+}
+
+static void parameter(uint8_t byte)
+{
+    switch (ili.cmd) {
+    case 0x2C:
+    case 0x3C:
+        ili.px[ili.nPx++] = byte;
+        if (ili.nPx == (ili.colmod == 0x55 ? 2 : 3)) {
+            storePixel();
+            ili.nPx = 0;
+        }
+        return;
+    case 0x2A:
+    case 0x2B:
+        if (ili.nArg < 4)
+            ili.arg[ili.nArg] = byte;
+        if (++ili.nArg == 4) {
+            uint16_t s = (uint16_t)((ili.arg[0] << 8) | ili.arg[1]);
+            uint16_t e = (uint16_t)((ili.arg[2] << 8) | ili.arg[3]);
+            if (ili.cmd == 0x2A) {
+                ili.sc = s; ili.ec = e;
+                ili.st.caset++;
+            } else {
+                ili.sp = s; ili.ep = e;
+                ili.st.paset++;
+            }
+            ili.windowUsed = 0;
+        }
+        return;
+    case 0x36:
+        if (ili.nArg++ == 0)
+            ili.madctl = byte;
+        return;
+    case 0x3A:
+        if (ili.nArg++ == 0)
+            ili.colmod = byte;
+        return;
+    default:
+        ili.nArg++;
+        return;
+    }
+}
+
+uint8_t iliShift(uint8_t mosi)
+{
+    if (ili.cs) {                  // Display não selecionado: byte perdido
+        ili.st.lostBytes++;
+        return 0xFF;
+    }
+
+    ili.st.bytes++;
+    if (ili.dc) {
+        ili.st.dataBytes++;
+        parameter(mosi);
+    } else {
+        ili.st.cmdBytes++;
+        command(mosi);
+    }
+    return 0x00;
+}
+
+// Houve tráfego ou transição de pino desde a última coleta de estatísticas?
+uint8_t iliActive(void)
+{
+    return ili.st.bytes || ili.st.lostBytes || ili.st.csToggles || ili.st.dcToggles;
+}
+
+void iliTakeStats(IliStats *stats)
+{
+    *stats = ili.st;
+    memset(&ili.st, 0, sizeof(ili.st));
+}
+
+const uint8_t *iliPixel(uint16_t x, uint16_t y)
+{
+    return gram[y][x];
+}
+
+// Grava a GRAM em PPM na orientação paisagem (MADCTL = 0x28 do tftInitSeq)
+int iliDumpPPM(const char *path)
+{
+    FILE *f = fopen(path, "wb");
+    uint16_t x, y;
+
+    if (!f)
+        return -1;
+    fprintf(f, "P6\n%d %d\n255\n", ILI_GRAM_ROWS, ILI_GRAM_COLS);
+    for (y = 0; y < ILI_GRAM_COLS; y++)
+        for (x = 0; x < ILI_GRAM_ROWS; x++)
+            fwrite(gram[y][x], 1, 3, f);
+    fclose(f);
+    return 0;
+}
@@ -0,0 +1,38 @@
+/// ili9341.h - Emulador do controlador ILI9341 usado no build de simulação
+#ifndef __ILI9341_H
+#define __ILI9341_H
+
+#include <stdint.h>
+
+#define ILI_GRAM_COLS   240     // Colunas físicas da GRAM (MV = 0)
+#define ILI_GRAM_ROWS   320     // Linhas físicas da GRAM (MV = 0)
+
+// Contadores de barramento acumulados entre dois quadros
+typedef struct {
+    uint32_t bytes;         // Bytes transferidos com CS ativo
+    uint32_t cmdBytes;      // Bytes com DC = 0
+    uint32_t dataBytes;     // Bytes com DC = 1
+    uint32_t pixels;        // Pixels gravados na GRAM (dentro da área válida)
+    uint32_t clipped;       // Pixels descartados por estarem fora da GRAM
+    uint32_t csToggles;     // Transições do pino CS
+    uint32_t dcToggles;     // Transições do pino DC
+    uint32_t caset;         // Comandos 0x2A (endereço de coluna)
+    uint32_t paset;         // Comandos 0x2B (endereço de página)
+    uint32_t ramwr;         // Comandos 0x2C/0x3C (escrita de memória)
+    uint32_t windows;       // Janelas distintas efetivamente usadas em escritas
+    uint32_t lostBytes;     // Bytes enviados com CS inativo
+} IliStats;
+
+void    iliReset    (void);
+void    iliPins     (uint8_t cs, uint8_t dc, uint8_t rst);
+uint8_t iliShift    (uint8_t mosi);
+
+uint8_t iliActive   (void);
+void    iliTakeStats(IliStats *stats);
+int     iliDumpPPM  (const char *path);
+
+// RGB de um pixel da tela (x < ILI_GRAM_ROWS, y < ILI_GRAM_COLS), na mesma
+// orientação dos PPMs
+const uint8_t *iliPixel(uint16_t x, uint16_t y);
+
+#endif // __ILI9341_H
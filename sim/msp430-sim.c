@@ -0,0 +1,523 @@
+/// msp430-sim.c - Registradores substitutos e ligação da USCI_B0 ao emulador do ILI9341
+///
+/// Variáveis de ambiente:
+///   SIM_FRAMES=n   encerra após n quadros (0 = executa main() até o fim)
+///   SIM_PPM=dir    grava dir/frame_NNN.ppm ao fim de cada quadro
+///   SIM_QUIET=1    não imprime o relatório por quadro nem o total
+///   SIM_BUTTON=ms[,ms...]  (em ordem crescente)
+///                  aperta S2 (P1.1) nesses instantes: cada aperto desce, repica
+///                  1 ms depois e é solto após BUTTON_HOLD_MS
+///
+/// Um quadro termina na primeira espera (__delay_cycles ou leitura de TA0R)
+/// após tráfego no barramento, ou seja, quando o programa para de desenhar e
+/// aguarda. O tempo simulado avança com as esperas, com os bytes do SPI e
+/// com cada leitura de TA0R, e o Timer_A0 conta ACLK = 32.768 Hz sobre ele.
+/// Em LPM sem outra interrupção pendente o tempo salta até a próxima
+/// comparação armada (CCR0 ou CCR1) ou até a próxima borda de SIM_BUTTON.
+/// O relatório final separa o tempo ativo, em LPM0 e em LPM3 e estima
+/// a corrente média com os valores típicos abaixo.
+#include <msp430.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "ili9341.h"
+#include "tft-lcd.h"
+#include "time-ctrl.h"
+
+// Dentro do simulador os pinos do display são lidos sem passar por simTouch()
+#undef  P2OUT
+#undef  P8OUT
+#define P2OUT   SIM_REG(P2OUT)
+#define P8OUT   SIM_REG(P8OUT)
+
+#define TX_IDLE 0xFFFF              // TXBUF vazio (nenhuma escrita pendente)
+#define POLL_CYCLES 16              // Ciclos de uma volta do laço que lê TA0R
+
+// Corrente típica do MSP430F5529 a 3 V (mA), aproximada da folha de dados
+#define MA_ACTIVE   9.0             // Ativo, 25 MHz, código na flash
+#define MA_LPM0     0.3             // LPM0 com o DCO em 25 MHz
+#define MA_LPM3     0.0025          // LPM3 com REFO e Timer_A
+
+#define BUTTON_MAX      16          // Apertos aceitos em SIM_BUTTON
+#define BUTTON_HOLD_MS  100         // Duração de cada aperto
+
+volatile uint16_t sim_WDTCTL;
+volatile uint16_t sim_UCSCTL0, sim_UCSCTL1, sim_UCSCTL2;
+volatile uint16_t sim_UCSCTL3, sim_UCSCTL4, sim_UCSCTL5;
+volatile uint16_t sim_PMMCTL0_H, sim_PMMCTL0_L;
+volatile uint16_t sim_PMMIFG = SVSMLDLYIFG;
+volatile uint16_t sim_SVSMHCTL, sim_SVSMLCTL;
+volatile uint16_t sim_P1DIR, sim_P1OUT, sim_P1SEL, sim_P1REN;
+volatile uint16_t sim_P1IN = 0xFF;    // Botões soltos (pull-up)
+volatile uint16_t sim_P1IE, sim_P1IES, sim_P1IFG, sim_P1IV;
+volatile uint16_t sim_P2DIR, sim_P2OUT, sim_P2SEL;
+volatile uint16_t sim_P3DIR, sim_P3OUT, sim_P3SEL;
+volatile uint16_t sim_P8DIR, sim_P8OUT, sim_P8SEL;
+volatile uint16_t sim_UCB0CTL0, sim_UCB0CTL1 = UCSWRST, sim_UCB0BRW;
+volatile uint16_t sim_UCB0STAT, sim_UCB0IFG = UCTXIFG, sim_UCB0IE;
+volatile uint16_t sim_UCB0TXBUF = TX_IDLE, sim_UCB0RXBUF;
+volatile uint16_t sim_DMACTL0, sim_DMA0CTL, sim_DMA0SZ;
+volatile uintptr_t sim_DMA0SA, sim_DMA0DA;
+volatile uint16_t sim_TA0CTL, sim_TA0R, sim_TA0IV;
+volatile uint16_t sim_TA0CCTL0, sim_TA0CCR0, sim_TA0CCTL1, sim_TA0CCR1;
+
+static volatile uint16_t *lastReg;  // Registrador do acesso anterior
+static uint16_t ifgShadow = UCTXIFG;    // UCB0IFG no acesso anterior (detecção de borda)
+static uint32_t dmaBytes;           // Bytes entregues ao TXBUF pelo DMA no quadro
+static uint16_t sr;                 // Registrador de status (GIE e bits de LPM)
+static uint16_t srOnExit;           // Bits a limpar do SR empilhado ao sair do ISR
+static uint8_t  inIsr;
+static uint8_t  inDma;              // Bytes entregues pelo DMA, sem a CPU
+
+// Rotinas de interrupção do firmware (ausentes quando o build não as define)
+void USCI_B0_ISR(void) __attribute__((weak));
+void DMA_ISR(void) __attribute__((weak));
+void TIMER0_A0_ISR(void) __attribute__((weak));
+void TIMER0_A1_ISR(void) __attribute__((weak));
+void PORT1_ISR(void) __attribute__((weak));
+
+// Contadores do próprio driver, quando presentes no build
+void tftTakeStats(TftStats * st) __attribute__((weak));
+static uint32_t frame;
+static uint32_t maxFrames;
+static const char *ppmDir;
+static uint8_t quiet;
+static uint64_t delayCycles;
+static uint64_t clockCycles;        // Tempo simulado, em ciclos de MCLK (FPROC)
+static uint64_t modeCycles[3];      // Ativo, LPM0 e LPM3
+static uint64_t timerBase;          // Ticks de ACLK no último TACLR
+static uint64_t timerTicks;         // Ticks desde timerBase na última atualização
+
+// Canais de comparação do Timer_A0 e seus vetores
+static volatile uint16_t * const cctl[2] = { &sim_TA0CCTL0, &sim_TA0CCTL1 };
+static volatile uint16_t * const ccr[2]  = { &sim_TA0CCR0, &sim_TA0CCR1 };
+static IliStats total;
+
+// Bordas de P1.1 vindas de SIM_BUTTON, em ordem de tempo
+static struct {
+    uint64_t at;                    // Ciclo de MCLK
+    uint8_t  level;                 // Nível do pino a partir de at
+} edges[4 * BUTTON_MAX];
+static uint8_t nEdges, nextEdge;
+
+// Avança o tempo simulado, contando os ciclos no modo de energia atual (os
+// ISRs contam como tempo ativo; os bytes do DMA, não)
+static void spend(uint64_t n)
+{
+    clockCycles += n;
+    if ((inIsr && !inDma) || !(sr & CPUOFF))
+        modeCycles[0] += n;
+    else
+        modeCycles[(sr & SCG1) ? 2 : 1] += n;
+}
+
+// Ticks a partir da última atualização até TA0R chegar a CCRn
+static uint32_t toMatch(int n)
+{
+    uint32_t d = (uint16_t)(*ccr[n] - (uint16_t)timerTicks);
+
+    return d ? d : 0x10000;
+}
+
+// Comparação n armada, com ISR presente no build?
+static int armed(int n)
+{
+    return (n ? TIMER0_A1_ISR != 0 : TIMER0_A0_ISR != 0) && (*cctl[n] & CCIE);
+}
+
+// Aplica as bordas de P1.1 já alcançadas pelo tempo simulado; uma borda no
+// sentido de P1IES levanta P1IFG, mesmo com P1IE desligado
+static void pinUpdate(void)
+{
+    for (; nextEdge < nEdges && edges[nextEdge].at <= clockCycles; nextEdge++) {
+        uint8_t level = edges[nextEdge].level;
+
+        if (level == !!(sim_P1IN & BIT1))
+            continue;
+        sim_P1IN = level ? (sim_P1IN | BIT1) : (sim_P1IN & ~BIT1);
+        if (level != !!(sim_P1IES & BIT1))
+            sim_P1IFG |= BIT1;
+    }
+}
+
+// Leva TA0R ao tempo simulado e levanta CCIFG nos canais pelos quais o
+// contador passou
+static void timerUpdate(void)
+{
+    uint64_t now = clockCycles * TIME_HZ / FPROC;
+    int n;
+
+    pinUpdate();
+    if (sim_TA0CTL & TACLR) {
+        timerBase  = now;
+        timerTicks = 0;
+        sim_TA0CTL &= ~TACLR;
+    }
+    if (!(sim_TA0CTL & MC_3))
+        return;
+    now -= timerBase;
+    for (n = 0; n < 2; n++)
+        if (timerTicks + toMatch(n) <= now)
+            *cctl[n] |= CCIFG;
+    timerTicks = now;
+    sim_TA0R = (uint16_t)now;
+}
+
+static void pins(void)
+{
+    iliPins((CSOUT & CSBIT) != 0, (DCOUT & DCBIT) != 0, (RSTOUT & RSTBIT) != 0);
+}
+
+// Desloca um byte do TXBUF para o display com o CS/DC vigentes
+static void shift(uint8_t byte)
+{
+    spend(8 * (sim_UCB0BRW ? sim_UCB0BRW : 1));
+    sim_UCB0RXBUF = iliShift(byte);
+    if (sim_UCB0IFG & UCRXIFG)
+        sim_UCB0STAT |= UCOE;       // RXBUF anterior não foi lido
+    sim_UCB0TXBUF = TX_IDLE;
+    sim_UCB0IFG |= UCTXIFG | UCRXIFG;
+}
+
+// Canal 0 do DMA disparado pela borda de subida de UCB0TXIFG: cada disparo
+// escreve um byte no TXBUF, o que volta a levantar UCTXIFG até DMA0SZ zerar.
+static void dmaTrigger(void)
+{
+    const uint8_t *src = (const uint8_t *)sim_DMA0SA;
+
+    if (!(sim_DMA0CTL & DMAEN) || (sim_DMACTL0 & 0x001F) != DMA0TSEL_19
+            || sim_DMA0DA != (uintptr_t)&sim_UCB0TXBUF)
+        return;
+
+    inDma = 1;
+    while (sim_DMA0SZ) {
+        shift(*src);
+        if ((sim_DMA0CTL & DMASRCINCR_3) == DMASRCINCR_3)
+            src++;
+        sim_DMA0SZ--;
+        dmaBytes++;
+    }
+    inDma = 0;
+    sim_DMA0SA  = (uintptr_t)src;
+    sim_DMA0CTL = (sim_DMA0CTL & ~DMAEN) | DMAIFG;
+}
+
+// Conclui o acesso anterior: uma escrita em TXBUF é deslocada para o display
+// com o CS/DC vigentes, uma escrita em P2OUT/P8OUT atualiza os pinos e uma
+// borda de subida em UCTXIFG dispara o DMA.
+static void settle(void)
+{
+    if (lastReg == &sim_UCB0TXBUF && sim_UCB0TXBUF != TX_IDLE) {
+        shift((uint8_t)sim_UCB0TXBUF);
+        dmaTrigger();
+    } else if (lastReg == &sim_P2OUT || lastReg == &sim_P8OUT) {
+        pins();
+    } else if (lastReg == &sim_UCB0IFG && !(ifgShadow & UCTXIFG) && (sim_UCB0IFG & UCTXIFG)) {
+        dmaTrigger();
+    }
+    ifgShadow = sim_UCB0IFG;
+    lastReg = 0;
+}
+
+static int timerPending(void)
+{
+    timerUpdate();
+    return (armed(0) && (sim_TA0CCTL0 & CCIFG)) || (armed(1) && (sim_TA0CCTL1 & CCIFG));
+}
+
+static int portPending(void)
+{
+    return PORT1_ISR && (sim_P1IE & sim_P1IFG & 0xFF);
+}
+
+static int irqPending(void)
+{
+    return (USCI_B0_ISR && (sim_UCB0IE & sim_UCB0IFG & UCTXIFG))
+        || (DMA_ISR && (sim_DMA0CTL & DMAIE) && (sim_DMA0CTL & DMAIFG))
+        || timerPending() || portPending();
+}
+
+// Atende as interrupções pendentes entre dois acessos do programa principal.
+// Devolve os bits de SR que os ISRs pediram para limpar ao retornar.
+static uint16_t dispatch(void)
+{
+    uint16_t onExit = 0;
+
+    if (inIsr || !(sr & GIE))
+        return 0;
+
+    inIsr = 1;
+    while (irqPending()) {
+        srOnExit = 0;
+        if (USCI_B0_ISR && (sim_UCB0IE & sim_UCB0IFG & UCTXIFG)) {
+            USCI_B0_ISR();
+        } else if (DMA_ISR && (sim_DMA0CTL & DMAIE) && (sim_DMA0CTL & DMAIFG)) {
+            DMA_ISR();
+        } else if (armed(0) && (sim_TA0CCTL0 & CCIFG)) {
+            sim_TA0CCTL0 &= ~CCIFG;     // O vetor do CCR0 limpa a flag
+            TIMER0_A0_ISR();
+        } else if (portPending()) {
+            PORT1_ISR();                // A leitura de P1IV limpa a flag
+        } else {
+            TIMER0_A1_ISR();            // A leitura de TA0IV limpa a flag do CCR1
+        }
+        settle();
+        onExit |= srOnExit;
+    }
+    inIsr = 0;
+    return onExit;
+}
+
+volatile uint16_t *simTouch(volatile uint16_t *reg)
+{
+    settle();
+    dispatch();
+    if (reg == &sim_UCB0RXBUF) {    // A leitura de RXBUF limpa RXIFG e UCOE
+        sim_UCB0IFG  &= ~UCRXIFG;
+        sim_UCB0STAT &= ~UCOE;
+    } else if (reg == &sim_UCB0TXBUF) {
+        sim_UCB0IFG &= ~UCTXIFG;
+    }
+    lastReg = reg;
+    return reg;
+}
+
+static void endFrame(void)
+{
+    IliStats st;
+    TftStats drv = { 0 };
+    char path[256];
+
+    iliTakeStats(&st);
+    if (tftTakeStats)
+        tftTakeStats(&drv);
+    if (!quiet)
+        printf("frame %3lu: bytes=%lu cmd=%lu data=%lu pixels=%lu clipped=%lu "
+               "cs=%lu dc=%lu caset=%lu paset=%lu ramwr=%lu windows=%lu dma=%lu "
+               "gpio=%u gpio_saved=%u addr_saved=%u glyph_hit=%u glyph_miss=%u\n",
+               (unsigned long)frame, (unsigned long)st.bytes,
+               (unsigned long)st.cmdBytes, (unsigned long)st.dataBytes,
+               (unsigned long)st.pixels, (unsigned long)st.clipped,
+               (unsigned long)st.csToggles, (unsigned long)st.dcToggles,
+               (unsigned long)st.caset, (unsigned long)st.paset,
+               (unsigned long)st.ramwr, (unsigned long)st.windows,
+               (unsigned long)dmaBytes, drv.gpioWrites, drv.gpioSaved, drv.addrSaved,
+               drv.glyphHits, drv.glyphMisses);
+    dmaBytes = 0;
+
+    if (ppmDir) {
+        snprintf(path, sizeof(path), "%s/frame_%03lu.ppm", ppmDir, (unsigned long)frame);
+        if (iliDumpPPM(path))
+            fprintf(stderr, "sim: falha ao gravar %s\n", path);
+    }
+
+    total.bytes     += st.bytes;
+    total.cmdBytes  += st.cmdBytes;
+    total.dataBytes += st.dataBytes;
+    total.pixels    += st.pixels;
+    total.csToggles += st.csToggles;
+    total.dcToggles += st.dcToggles;
+    total.windows   += st.windows;
+    frame++;
+
+    if (maxFrames && frame >= maxFrames)
+        exit(0);
+}
+
+static void finish(void)
+{
+    maxFrames = 0;                  // Já estamos encerrando
+    settle();
+    if (iliActive())
+        endFrame();
+    if (quiet)
+        return;
+    printf("total: frames=%lu bytes=%lu cmd=%lu data=%lu pixels=%lu cs=%lu dc=%lu "
+           "windows=%lu delay_cycles=%llu\n",
+           (unsigned long)frame, (unsigned long)total.bytes,
+           (unsigned long)total.cmdBytes, (unsigned long)total.dataBytes,
+           (unsigned long)total.pixels, (unsigned long)total.csToggles,
+           (unsigned long)total.dcToggles, (unsigned long)total.windows,
+           (unsigned long long)delayCycles);
+    if (clockCycles) {
+        double t = (double)clockCycles;
+        double act = modeCycles[0] / t, lpm0 = modeCycles[1] / t, lpm3 = modeCycles[2] / t;
+
+        printf("energia: tempo=%.3f s ativo=%.2f%% lpm0=%.2f%% lpm3=%.2f%% corrente_media=%.3f mA\n",
+               t / FPROC, 100 * act, 100 * lpm0, 100 * lpm3,
+               act * MA_ACTIVE + lpm0 * MA_LPM0 + lpm3 * MA_LPM3);
+    }
+}
+
+void simDelayCycles(unsigned long cycles)
+{
+    settle();
+    dispatch();                     // O ISR continua transmitindo durante a espera
+    delayCycles += cycles;
+    spend(cycles);
+    if (iliActive())
+        endFrame();
+}
+
+volatile uint16_t *simTimer(void)
+{
+    settle();
+    dispatch();
+    spend(POLL_CYCLES);
+    if (iliActive())
+        endFrame();
+    timerUpdate();
+    return &sim_TA0R;
+}
+
+volatile uint16_t *simTimerIv(void)
+{
+    settle();
+    timerUpdate();
+    sim_TA0IV = 0;
+    if (sim_TA0CCTL1 & CCIFG) {
+        sim_TA0CCTL1 &= ~CCIFG;
+        sim_TA0IV = TA0IV_TACCR1;
+    }
+    return &sim_TA0IV;
+}
+
+volatile uint16_t *simP1Iv(void)
+{
+    uint16_t pending;
+    int n;
+
+    settle();
+    pinUpdate();
+    pending = sim_P1IE & sim_P1IFG & 0xFF;
+    sim_P1IV = 0;
+    for (n = 0; n < 8; n++)
+        if (pending & (1u << n)) {
+            sim_P1IFG &= ~(1u << n);
+            sim_P1IV = 2 * (n + 1);
+            break;
+        }
+    return &sim_P1IV;
+}
+
+void simDataWriteAddr(unsigned short addr, unsigned long value)
+{
+    settle();
+    if (addr == (unsigned short)(uintptr_t)&sim_DMA0SA)
+        sim_DMA0SA = (uintptr_t)value;
+    else if (addr == (unsigned short)(uintptr_t)&sim_DMA0DA)
+        sim_DMA0DA = (uintptr_t)value;
+}
+
+// Sem nada pendente, a CPU dormindo só pode ser acordada por uma comparação
+// do Timer_A0 ou por uma borda de P1.1: o tempo salta até a mais próxima.
+// Devolve 0 se não há nenhuma pela frente.
+static int sleepUntilEvent(void)
+{
+    uint64_t target = 0;
+    uint32_t d = 0;
+    int n;
+
+    timerUpdate();
+    if ((sim_TA0CTL & MC_3) && !(sr & OSCOFF)) {    // Em LPM4 o ACLK para e o timer junto
+        for (n = 0; n < 2; n++)
+            if (armed(n) && (!d || toMatch(n) < d))
+                d = toMatch(n);
+        if (d)
+            target = ((timerBase + timerTicks + d) * FPROC + TIME_HZ - 1) / TIME_HZ;
+    }
+    if (nextEdge < nEdges && (!target || edges[nextEdge].at < target))
+        target = edges[nextEdge].at;
+    if (!target)
+        return 0;
+    if (iliActive())
+        endFrame();                 // A espera encerra o quadro, como __delay_cycles
+    if (target > clockCycles)
+        spend(target - clockCycles);
+    timerUpdate();
+    return 1;
+}
+
+// Entrar em LPM só retorna quando um ISR limpa CPUOFF ao sair; sem nenhuma
+// interrupção pendente nem evento pela frente o programa terminou.
+void simBisSR(uint16_t bits)
+{
+    settle();
+    sr |= bits;
+    if (!(bits & CPUOFF)) {
+        dispatch();
+        return;
+    }
+    for (;;) {
+        if (!(sr & GIE) || (!irqPending() && !sleepUntilEvent()))
+            exit(0);
+        if (dispatch() & CPUOFF)
+            break;
+    }
+    sr &= ~(LPM4_bits);
+}
+
+void simBicSR(uint16_t bits)
+{
+    settle();
+    sr &= ~bits;
+}
+
+void simBicSROnExit(uint16_t bits)
+{
+    srOnExit |= bits;
+}
+
+uint16_t simGetSR(void)
+{
+    return sr;
+}
+
+// Converte SIM_BUTTON em bordas de P1.1: desce, repica, desce de novo e sobe
+static void buttonScript(const char *env)
+{
+    static const struct { uint16_t ms; uint8_t level; } press[4] = {
+        { 0, 0 }, { 1, 1 }, { 2, 0 }, { BUTTON_HOLD_MS, 1 },
+    };
+    char *end;
+    int i;
+
+    while (env && *env && nEdges < 4 * BUTTON_MAX) {
+        uint64_t ms = strtoull(env, &end, 10);
+
+        if (end == env)
+            break;
+        for (i = 0; i < 4; i++) {
+            edges[nEdges].at    = (ms + press[i].ms) * (FPROC / 1000);
+            edges[nEdges].level = press[i].level;
+            nEdges++;
+        }
+        env = (*end == ',') ? end + 1 : end;
+    }
+}
+
+// __set_interrupt_state() restaura o GIE salvo por __get_interrupt_state()
+void simSetGIE(uint16_t state)
+{
+    if (state & GIE)
+        simBisSR(GIE);
+    else
+        simBicSR(GIE);
+}
+
+__attribute__((constructor))
+static void simInit(void)
+{
+    const char *env = getenv("SIM_FRAMES");
+    IliStats st;
+
+    maxFrames = env ? (uint32_t)strtoul(env, 0, 10) : 0;
+    ppmDir    = getenv("SIM_PPM");
+    env       = getenv("SIM_QUIET");
+    quiet     = env && *env != '0';
+    buttonScript(getenv("SIM_BUTTON"));
+    iliReset();
+    pins();                         // Sincroniza o emulador com as portas zeradas
+    iliTakeStats(&st);
+    atexit(finish);
+}
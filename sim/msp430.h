@@ -0,0 +1,221 @@
+/// msp430.h - Registradores substitutos do MSP430F5529 para o build de simulação no host
+///
+/// Este cabeçalho é encontrado antes do <msp430.h> da TI quando o código é
+/// compilado com -Isim (ver sim/Makefile). Os registradores ligados ao
+/// display (P2OUT, P8OUT e a USCI_B0) passam por simTouch(), que entrega ao
+/// emulador do ILI9341 cada escrita no momento exato em que ela acontece.
+#ifndef __SIM_MSP430_H
+#define __SIM_MSP430_H
+
+#include <stdint.h>
+
+// Acesso monitorado: a chamada ocorre antes da leitura/escrita do registrador
+// e conclui o acesso anterior, de modo que a ordem dos eventos é preservada.
+volatile uint16_t *simTouch(volatile uint16_t *reg);
+
+#define SIM_REG(name)   sim_##name
+#define SIM_HOOK(name)  (*simTouch(&sim_##name))
+
+extern volatile uint16_t sim_WDTCTL;
+extern volatile uint16_t sim_UCSCTL0, sim_UCSCTL1, sim_UCSCTL2;
+extern volatile uint16_t sim_UCSCTL3, sim_UCSCTL4, sim_UCSCTL5;
+extern volatile uint16_t sim_PMMCTL0_H, sim_PMMCTL0_L, sim_PMMIFG;
+extern volatile uint16_t sim_SVSMHCTL, sim_SVSMLCTL;
+extern volatile uint16_t sim_P1DIR, sim_P1OUT, sim_P1SEL, sim_P1IN, sim_P1REN;
+extern volatile uint16_t sim_P1IE, sim_P1IES, sim_P1IFG;
+extern volatile uint16_t sim_P2DIR, sim_P2OUT, sim_P2SEL;
+extern volatile uint16_t sim_P3DIR, sim_P3OUT, sim_P3SEL;
+extern volatile uint16_t sim_P8DIR, sim_P8OUT, sim_P8SEL;
+extern volatile uint16_t sim_UCB0CTL0, sim_UCB0CTL1, sim_UCB0BRW;
+extern volatile uint16_t sim_UCB0STAT, sim_UCB0IFG, sim_UCB0IE;
+extern volatile uint16_t sim_UCB0TXBUF, sim_UCB0RXBUF;
+extern volatile uint16_t sim_DMACTL0, sim_DMA0CTL, sim_DMA0SZ;
+extern volatile uintptr_t sim_DMA0SA, sim_DMA0DA;
+extern volatile uint16_t sim_TA0CTL, sim_TA0R, sim_TA0IV;
+extern volatile uint16_t sim_TA0CCTL0, sim_TA0CCR0, sim_TA0CCTL1, sim_TA0CCR1;
+
+// TA0R acompanha o tempo simulado; cada leitura custa um passo de espera.
+// Ler TA0IV devolve e limpa a flag pendente do CCR1.
+volatile uint16_t *simTimer(void);
+volatile uint16_t *simTimerIv(void);
+
+// Ler P1IV devolve e limpa a flag pendente de menor número (com P1IE)
+volatile uint16_t *simP1Iv(void);
+
+// Sistema
+#define WDTCTL      SIM_REG(WDTCTL)
+#define UCSCTL0     SIM_REG(UCSCTL0)
+#define UCSCTL1     SIM_REG(UCSCTL1)
+#define UCSCTL2     SIM_REG(UCSCTL2)
+#define UCSCTL3     SIM_REG(UCSCTL3)
+#define UCSCTL4     SIM_REG(UCSCTL4)
+#define UCSCTL5     SIM_REG(UCSCTL5)
+#define PMMCTL0_H   SIM_REG(PMMCTL0_H)
+#define PMMCTL0_L   SIM_REG(PMMCTL0_L)
+#define PMMIFG      SIM_REG(PMMIFG)
+#define SVSMHCTL    SIM_REG(SVSMHCTL)
+#define SVSMLCTL    SIM_REG(SVSMLCTL)
+
+// Portas (P2 e P8 carregam DC, RST, LED e CS do display; P1.1 é o botão S2)
+#define P1DIR       SIM_REG(P1DIR)
+#define P1OUT       SIM_REG(P1OUT)
+#define P1SEL       SIM_REG(P1SEL)
+#define P1IN        SIM_REG(P1IN)
+#define P1REN       SIM_REG(P1REN)
+#define P1IE        SIM_REG(P1IE)
+#define P1IES       SIM_REG(P1IES)
+#define P1IFG       SIM_REG(P1IFG)
+#define P1IV        (*simP1Iv())
+#define P1IV_P1IFG1 (0x0004)
+#define P1IV_P1IFG7 (0x0010)
+#define P2DIR       SIM_REG(P2DIR)
+#define P2OUT       SIM_HOOK(P2OUT)
+#define P2SEL       SIM_REG(P2SEL)
+#define P3DIR       SIM_REG(P3DIR)
+#define P3OUT       SIM_REG(P3OUT)
+#define P3SEL       SIM_REG(P3SEL)
+#define P8DIR       SIM_REG(P8DIR)
+#define P8OUT       SIM_HOOK(P8OUT)
+#define P8SEL       SIM_REG(P8SEL)
+
+// USCI_B0 em modo SPI
+#define UCB0CTL0    SIM_REG(UCB0CTL0)
+#define UCB0CTL1    SIM_REG(UCB0CTL1)
+#define UCB0BRW     SIM_REG(UCB0BRW)
+#define UCB0STAT    SIM_HOOK(UCB0STAT)
+#define UCB0IFG     SIM_HOOK(UCB0IFG)
+#define UCB0IE      SIM_HOOK(UCB0IE)
+#define UCB0TXBUF   SIM_HOOK(UCB0TXBUF)
+#define UCB0RXBUF   SIM_HOOK(UCB0RXBUF)
+
+// Controlador de DMA (canal 0)
+#define DMACTL0     SIM_REG(DMACTL0)
+#define DMA0CTL     SIM_HOOK(DMA0CTL)
+#define DMA0SA      SIM_REG(DMA0SA)
+#define DMA0DA      SIM_REG(DMA0DA)
+#define DMA0SZ      SIM_REG(DMA0SZ)
+
+// Timer_A0 (contínuo em ACLK)
+#define TA0CTL      SIM_REG(TA0CTL)
+#define TA0R        (*simTimer())
+#define TA0CCTL0    SIM_REG(TA0CCTL0)
+#define TA0CCR0     SIM_REG(TA0CCR0)
+#define TA0CCTL1    SIM_REG(TA0CCTL1)
+#define TA0CCR1     SIM_REG(TA0CCR1)
+#define TA0IV       (*simTimerIv())
+
+#define BIT0        (0x0001)
+#define BIT1        (0x0002)
+#define BIT2        (0x0004)
+#define BIT3        (0x0008)
+#define BIT4        (0x0010)
+#define BIT5        (0x0020)
+#define BIT6        (0x0040)
+#define BIT7        (0x0080)
+
+#define WDTPW       (0x5A00)
+#define WDTHOLD     (0x0080)
+
+#define GIE         (0x0008)
+#define CPUOFF      (0x0010)
+#define OSCOFF      (0x0020)
+#define SCG0        (0x0040)
+#define SCG1        (0x0080)
+#define LPM0_bits   (CPUOFF)
+#define LPM3_bits   (SCG1 + SCG0 + CPUOFF)
+#define LPM4_bits   (SCG1 + SCG0 + OSCOFF + CPUOFF)
+
+#define SELREF_2    (0x0020)
+#define DCORSEL_5   (0x0050)
+#define FLLD_0      (0x0000)
+#define SELA_2      (0x0200)
+#define SELA_3      (0x0300)
+#define SELA_7      (0x0700)
+#define DIVPA_5     (0x5000)
+#define DIVA_5      (0x0500)
+#define DIVA_7      (0x0700)
+
+#define TASSEL_1    (0x0100)
+#define MC_2        (0x0020)
+#define MC_3        (0x0030)
+#define TACLR       (0x0004)
+#define CCIE        (0x0010)
+#define CCIFG       (0x0001)
+#define TA0IV_TACCR1 (0x0002)
+#define TA0IV_TAIFG  (0x000E)
+
+#define PMMPW_H     (0xA5)
+#define PMMCOREV0   (0x0001)
+#define SVSHE       (0x0400)
+#define SVSHRVL0    (0x0100)
+#define SVMHE       (0x4000)
+#define SVSMHRRL0   (0x0001)
+#define SVSLE       (0x0400)
+#define SVSLRVL0    (0x0100)
+#define SVMLE       (0x4000)
+#define SVSMLRRL0   (0x0001)
+#define SVSMLDLYIFG (0x0001)
+#define SVMLIFG     (0x0002)
+#define SVMLVLRIFG  (0x0004)
+
+#define UCCKPH      (0x80)
+#define UCCKPL      (0x40)
+#define UCMSB       (0x20)
+#define UC7BIT      (0x10)
+#define UCMST       (0x08)
+#define UCMODE_0    (0x00)
+#define UCSYNC      (0x01)
+#define UCSSEL__SMCLK (0x80)
+#define UCSWRST     (0x01)
+#define UCBUSY      (0x01)
+#define UCOE        (0x20)
+#define UCRXIFG     (0x0001)
+#define UCTXIFG     (0x0002)
+#define UCRXIE      (0x0001)
+#define UCTXIE      (0x0002)
+
+#define DMA0TSEL_19 (0x0013)      // Gatilho UCB0TXIFG no F5529
+#define DMADT_0     (0x0000)
+#define DMADSTINCR_0 (0x0000)
+#define DMADSTINCR_3 (0x0C00)
+#define DMASRCINCR_0 (0x0000)
+#define DMASRCINCR_3 (0x0300)
+#define DMADSTBYTE  (0x0080)
+#define DMASRCBYTE  (0x0040)
+#define DMALEVEL    (0x0020)
+#define DMAEN       (0x0010)
+#define DMAIFG      (0x0008)
+#define DMAIE       (0x0004)
+
+// Vetores de interrupção: o simulador chama USCI_B0_ISR(), DMA_ISR(),
+// TIMER0_A0_ISR(), TIMER0_A1_ISR() e PORT1_ISR() quando a interrupção
+// correspondente está habilitada, pendente e GIE = 1
+#define USCI_B0_VECTOR   (56)
+#define DMA_VECTOR       (50)
+#define TIMER0_A0_VECTOR (53)
+#define TIMER0_A1_VECTOR (52)
+#define PORT1_VECTOR     (47)
+#define __interrupt
+
+// Intrínsecos do compilador da TI
+void simDataWriteAddr(unsigned short addr, unsigned long value);
+void simDelayCycles(unsigned long cycles);
+void simBisSR(uint16_t bits);
+void simBicSR(uint16_t bits);
+void simBicSROnExit(uint16_t bits);
+uint16_t simGetSR(void);
+void simSetGIE(uint16_t state);
+
+#define __delay_cycles(n)       simDelayCycles(n)
+#define __bis_SR_register(b)    simBisSR(b)
+#define __bic_SR_register(b)    simBicSR(b)
+#define __bic_SR_register_on_exit(b) simBicSROnExit(b)
+#define __enable_interrupt()    simBisSR(GIE)
+#define __disable_interrupt()   simBicSR(GIE)
+#define __data16_write_addr(a, v) simDataWriteAddr(a, v)
+#define __no_operation()        ((void)0)
+#define __even_in_range(v, r)   (v)
+#define __get_interrupt_state() simGetSR()
+#define __set_interrupt_state(s) simSetGIE(s)
+
+#endif // __SIM_MSP430_H
@@ -1,5 +1,31 @@
 #include <msp430.h> 
 #include <stdint.h>
+#include "spi.h"
+
+#define SPIQ_SIZE    16     // Segmentos na fila (potência de 2)
+#define SPIQ_DMA_MIN 64     // Segmentos a partir daqui (bytes no total) vão por DMA
+#define SPIQ_REP     192    // Buffer de repetição: múltiplo de 2, 3 e 4 bytes
+
+// Segmento da fila: o padrão src[0..len-1] é enviado count vezes
+typedef struct {
+    const uint8_t * src;    // Aponta para inl quando o padrão tem até 4 bytes
+    uint16_t count;         // Repetições do padrão
+    uint8_t  len;           // Bytes do padrão (0 = segmento só de controle)
+    uint8_t  flags;         // Nível de DC e controle de CS (SPIQ_*)
+    uint8_t  inl[4];        // Cópia local de padrões curtos (comandos, endereços, cores)
+} SpiSeg;
+
+static struct {
+    SpiSeg   ring[SPIQ_SIZE];
+    volatile uint8_t head;  // Próximo segmento livre (escrito pelo programa)
+    volatile uint8_t tail;  // Segmento em transmissão (escrito pelo ISR)
+    uint8_t  started;       // Pinos do segmento atual já aplicados
+    uint8_t  idx;           // Próximo byte do padrão
+    uint16_t left;          // Repetições restantes do segmento atual
+    uint8_t  per;           // Repetições do padrão em rep (0 = rep não usado)
+    uint8_t  rep[SPIQ_REP]; // Padrão curto repetido, fonte dos blocos de DMA
+    void  (* pins)(uint8_t flags);
+} spiq;
 
 void spiConfig(uint8_t phase, uint8_t polarity)
 {
@@ -32,3 +58,212 @@ uint8_t spiTransfer(uint8_t byte)
     while(!(UCB0IFG & UCRXIFG));  // Aguarda até que o buffer de recepção tenha um dado disponível
     return UCB0RXBUF;             // Retorna o byte recebido no buffer de recepção
 }
+
+// Aguarda o fim do deslocamento e descarta o RX acumulado (limpa UCRXIFG e UCOE)
+static void spiDrain()
+{
+    while(UCB0STAT & UCBUSY);     // Aguarda o último byte sair do registrador de deslocamento
+    (void) UCB0RXBUF;             // Descarta o byte recebido e limpa UCOE
+}
+
+void spiWriteBurst(const uint8_t * buf, uint16_t n)
+{
+    while(n--) {
+        while(!(UCB0IFG & UCTXIFG));  // Só espera o TXBUF esvaziar; o RX é ignorado
+        UCB0TXBUF = *buf++;
+    }
+    spiDrain();
+}
+
+void spiWriteRepeat(const uint8_t * pattern, uint8_t patternLen, uint16_t count)
+{
+    uint8_t i;
+
+    while(count--) {
+        for(i = 0; i < patternLen; i++) {
+            while(!(UCB0IFG & UCTXIFG));
+            UCB0TXBUF = pattern[i];
+        }
+    }
+    spiDrain();
+}
+
+void spiDmaStart(const uint8_t * src, uint16_t n, uint8_t fixedSrc)
+{
+    DMACTL0 = (DMACTL0 & ~0x001F) | DMA0TSEL_19;   // Canal 0 disparado por UCB0TXIFG
+    __data16_write_addr((unsigned short) &DMA0SA, (unsigned long) src);
+    __data16_write_addr((unsigned short) &DMA0DA, (unsigned long) &UCB0TXBUF);
+    DMA0SZ  = n;                                    // Número de bytes a transmitir
+    DMA0CTL =
+    DMADT_0      |                                  // Transferência simples a cada disparo
+    DMADSTINCR_0 |                                  // Destino fixo (UCB0TXBUF)
+    (fixedSrc ? DMASRCINCR_0 : DMASRCINCR_3) |      // Fonte fixa (preenchimento) ou incrementada
+    DMADSTBYTE   |
+    DMASRCBYTE   |
+    DMAEN;
+
+    UCB0IFG &= ~UCTXIFG;  // O gatilho é sensível à borda: recria a subida de UCTXIFG
+    UCB0IFG |=  UCTXIFG;  // para que o DMA comece a alimentar o TXBUF
+}
+
+uint8_t spiDmaBusy()
+{
+    return (DMA0CTL & DMAEN) != 0;  // DMAEN é limpo pelo hardware ao fim do bloco
+}
+
+void spiDmaWait()
+{
+    while(DMA0CTL & DMAEN);       // Aguarda o DMA entregar o último byte ao TXBUF
+    spiDrain();
+}
+
+// pins() é chamada pelo ISR no início de cada segmento, com o barramento
+// parado, para ajustar DC e CS conforme as flags do segmento.
+void spiQueueConfig(void (*pins)(uint8_t flags))
+{
+    spiq.pins = pins;
+    spiq.head = spiq.tail = 0;
+    spiq.started = 0;
+}
+
+void spiQueuePush(const uint8_t * src, uint8_t len, uint16_t count, uint8_t flags)
+{
+    SpiSeg * seg;
+    uint16_t gie = __get_interrupt_state();
+    uint8_t next, i;
+
+    __disable_interrupt();
+    next = (spiq.head + 1) & (SPIQ_SIZE - 1);
+    while(next == spiq.tail) {                // Fila cheia: dorme até o ISR liberar espaço
+        __bis_SR_register(LPM0_bits | GIE);
+        __disable_interrupt();
+    }
+
+    seg = &spiq.ring[spiq.head];
+    seg->count = count;
+    seg->len   = len;
+    seg->flags = flags;
+    if(len <= sizeof(seg->inl)) {             // Padrões curtos são copiados: o chamador
+        for(i = 0; i < len; i++)              // pode reutilizar o buffer imediatamente
+            seg->inl[i] = src[i];
+        seg->src = seg->inl;
+    } else {
+        seg->src = src;                       // Padrões longos devem viver até spiQueueFlush()
+    }
+    spiq.head = next;
+
+    UCB0IE |= UCTXIE;                         // UCTXIFG pendente dispara o ISR
+    __set_interrupt_state(gie);               // Restaura o GIE de quem chamou
+}
+
+uint8_t spiQueueBusy()
+{
+    return spiq.tail != spiq.head;
+}
+
+void spiQueueFlush()
+{
+    uint16_t gie = __get_interrupt_state();
+
+    __disable_interrupt();
+    while(spiq.tail != spiq.head) {           // Dorme em LPM0 enquanto o ISR esvazia a fila
+        __bis_SR_register(LPM0_bits | GIE);
+        __disable_interrupt();
+    }
+    __set_interrupt_state(gie);
+    spiDrain();
+}
+
+// Prepara a fonte do DMA para o segmento que começa: padrões de 2 a
+// SPIQ_DMA_MIN - 1 bytes são copiados várias vezes em rep, para que cada
+// bloco leve muitas repetições
+static void spiqDmaSetup(const SpiSeg * seg)
+{
+    uint8_t i, j;
+
+    spiq.per = 0;
+    if(seg->len == 1 || seg->len >= SPIQ_DMA_MIN)
+        return;                               // Fonte fixa ou o próprio bloco
+    for(i = 0; i + seg->len <= SPIQ_REP; i += seg->len, spiq.per++)
+        for(j = 0; j < seg->len; j++)
+            spiq.rep[i + j] = seg->src[j];
+}
+
+// Arma o DMA com o próximo bloco do segmento: o byte único inteiro com fonte
+// fixa, um bloco longo por repetição ou até per cópias de rep
+static void spiqDmaNext(const SpiSeg * seg)
+{
+    uint16_t n;
+
+    if(seg->len == 1) {
+        n = spiq.left;
+        spiDmaStart(seg->src, n, 1);
+    } else if(!spiq.per) {
+        n = 1;
+        spiDmaStart(seg->src, seg->len, 0);
+    } else {
+        n = spiq.left < spiq.per ? spiq.left : spiq.per;
+        spiDmaStart(spiq.rep, n * seg->len, 0);
+    }
+    spiq.left -= n;
+    DMA0CTL |= DMAIE;
+}
+
+#pragma vector=USCI_B0_VECTOR
+__interrupt void USCI_B0_ISR(void)
+{
+    SpiSeg * seg;
+
+    while(spiq.tail != spiq.head) {
+        seg = &spiq.ring[spiq.tail];
+
+        if(!spiq.started) {                   // Início do segmento
+            while(UCB0STAT & UCBUSY);         // DC/CS só mudam com o barramento parado
+            spiq.pins(seg->flags);
+            spiq.started = 1;
+            spiq.idx  = 0;
+            spiq.left = seg->len ? seg->count : 0;
+
+            if((uint32_t)seg->len * spiq.left >= SPIQ_DMA_MIN) {
+                spiqDmaSetup(seg);
+                UCB0IE &= ~UCTXIE;            // Segmento longo: o DMA assume até o fim
+                spiqDmaNext(seg);             // DMA_ISR encadeia os blocos seguintes
+                return;
+            }
+        }
+
+        if(spiq.left) {
+            UCB0TXBUF = seg->src[spiq.idx];
+            if(++spiq.idx == seg->len) {
+                spiq.idx = 0;
+                spiq.left--;
+            }
+            if(!spiq.left) {                  // Último byte já está no TXBUF
+                spiq.tail = (spiq.tail + 1) & (SPIQ_SIZE - 1);
+                spiq.started = 0;
+                __bic_SR_register_on_exit(LPM0_bits);
+            }
+            return;                           // Um byte por interrupção
+        }
+
+        spiq.tail = (spiq.tail + 1) & (SPIQ_SIZE - 1);   // Segmento só de controle
+        spiq.started = 0;
+    }
+
+    UCB0IE &= ~UCTXIE;                        // Fila vazia: UCTXIFG fica pendente
+    __bic_SR_register_on_exit(LPM0_bits);
+}
+
+#pragma vector=DMA_VECTOR
+__interrupt void DMA_ISR(void)
+{
+    DMA0CTL &= ~(DMAIFG | DMAIE);
+    if(spiq.left) {                           // Segmento continua: próximo bloco
+        spiqDmaNext(&spiq.ring[spiq.tail]);
+        return;
+    }
+    spiq.tail = (spiq.tail + 1) & (SPIQ_SIZE - 1);
+    spiq.started = 0;
+    UCB0IE |= UCTXIE;                         // Segue com o próximo segmento
+    __bic_SR_register_on_exit(LPM0_bits);
+}
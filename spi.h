@@ -4,8 +4,27 @@
 #include <msp430.h> 
 #include <stdint.h>
 
-void spiConfig();
+void spiConfig(uint8_t phase, uint8_t polarity);
 uint8_t spiTransfer(uint8_t byte);
 
+// Escrita sem leitura: mantém o TXBUF cheio e descarta o RX apenas no fim
+void spiWriteBurst  (const uint8_t * buf, uint16_t n);
+void spiWriteRepeat (const uint8_t * pattern, uint8_t patternLen, uint16_t count);
+
+// Transmissão por DMA (canal 0 disparado por UCB0TXIFG)
+void    spiDmaStart (const uint8_t * src, uint16_t n, uint8_t fixedSrc);
+uint8_t spiDmaBusy  ();
+void    spiDmaWait  ();
+
+// Fila de transmissão alimentada pela interrupção de TX da USCI_B0
+#define SPIQ_DATA   0x01    // Segmento enviado com DC = 1 (dados)
+#define SPIQ_BEGIN  0x02    // Segmento de controle: ativa o CS
+#define SPIQ_END    0x04    // Segmento de controle: desativa o CS
+
+void    spiQueueConfig  (void (*pins)(uint8_t flags));
+void    spiQueuePush    (const uint8_t * src, uint8_t len, uint16_t count, uint8_t flags);
+uint8_t spiQueueBusy    ();
+void    spiQueueFlush   ();
+
 
 #endif // __SPI_H
@@ -4,138 +4,542 @@
 #include "time-ctrl.h"
 #include "tft-lcd.h"
 #include "fonts.h"
+#include "_fonts/fonts.h"
+
+#define FILL_PIXELS 64                    // Pixels no buffer de preenchimento por DMA
+#define FILL_DMA_MIN 32                   // Abaixo disso o custo de armar o DMA não compensa
+
+#define GLYPH_COLS 5                      // Colunas de font5x7 (um byte por coluna)
+#define GLYPH_W    6                      // Célula: 5 colunas + 1 de espaçamento
+#define GLYPH_H    8                      // Célula: 8 linhas (bit 7 = descendentes)
+#define MADCTL_COLS 0x08                  // BGR com MV desligado: escrita desce pelas colunas
+#define SPAN_MAX   14                     // Trechos verticais por coluna (28 linhas alternadas)
+#define AA_W_MIN   12                     // Largura da fontAA24, a mais estreita das fontes AA
+#define AA_CHARS   (320 / AA_W_MIN)       // Glifos que cabem numa linha em paisagem
+
+#if !TFT_SPI_QUEUE
+static uint8_t fillBuf[FILL_PIXELS * TFT_PIXEL_BYTES];  // Padrão repetido enviado pelo DMA
+#endif
+
+// Sessão com o display: CS é ativado uma vez por tftBegin()/tftEnd() externos
+// e CS/DC só são escritos quando o nível realmente muda.
+static struct {
+    uint8_t  depth;        // Aninhamento de tftBegin()/tftEnd()
+    uint8_t  cs;           // CS ativo (nível baixo) no momento
+    uint8_t  dc;           // Nível atual de DC (1 = dados)
+    TftStats st;
+    struct {               // Cópia da janela programada no controlador
+        uint8_t  valid;
+        uint16_t x1, x2, y1, y2;
+        uint16_t col, page;    // Ponteiro de escrita após o último pixel
+    } win;
+    const uint8_t * initPc;    // Próxima entrada de tftInitProg (0 = display pronto)
+    uint16_t initStart;        // Início da espera da entrada anterior (timeNow())...
+    uint16_t initWait;         // ...e sua duração em ticks; conta o tempo decorrido,
+                               // que continua certo se main() demorar a consultar
+} tft = { 0, 0, 1 };
+
+#if TFT_GLYPH_CACHE
+#define CELL_BYTES (GLYPH_W * GLYPH_H * TFT_PIXEL_BYTES)   // Célula 6x8 no barramento
+
+// Cache LRU de células prontas, na ordem em que glyphCells as envia (por
+// colunas com TFT_TEXT_COLUMNS, por linhas sem). order[] lista as entradas da
+// mais para a menos recente; a última é a substituída. A seção .usbram não é
+// zerada no boot: tftConfig() esvazia o cache.
+typedef struct {
+    uint8_t     px[TFT_GLYPH_CACHE][CELL_BYTES];
+    tft_color_t fg[TFT_GLYPH_CACHE];
+    tft_color_t bg[TFT_GLYPH_CACHE];
+    uint8_t     c[TFT_GLYPH_CACHE];    // Caractere Latin-1
+    uint8_t     order[TFT_GLYPH_CACHE];
+    uint8_t     used;          // Entradas válidas
+} GlyphCache;
+
+#pragma DATA_SECTION(gcache, ".usbram")
+static GlyphCache gcache;
+#endif
+
+static void pinCS(uint8_t active)
+{
+    if (active == tft.cs) {
+        tft.st.gpioSaved++;
+        return;
+    }
+    if (active)
+        CSOUT &= ~CSBIT;
+    else
+        CSOUT |= CSBIT;
+    tft.cs = active;
+    tft.st.gpioWrites++;
+}
+
+static void pinDC(uint8_t data)
+{
+    if (data == tft.dc) {
+        tft.st.gpioSaved++;
+        return;
+    }
+    if (data)
+        DCOUT |= DCBIT;
+    else
+        DCOUT &= ~DCBIT;
+    tft.dc = data;
+    tft.st.gpioWrites++;
+}
+
+// Separa a cor já codificada nos bytes enviados ao display, uma vez por chamada
+static void tftBytes(tft_color_t color, uint8_t * px)
+{
+#if TFT_RGB565
+    px[0] = color >> 8;    // RRRRRGGG
+    px[1] = color;         // GGGBBBBB
+#else
+    px[0] = color >> 16;   // RGB666: 6 bits mais significativos de cada byte
+    px[1] = color >> 8;
+    px[2] = color;
+#endif
+}
+
+// Todos os bytes do pixel são iguais? (branco, preto, alguns cinzas)
+static uint8_t tftUniform(const uint8_t * px)
+{
+    uint8_t i;
+
+    for (i = 1; i < TFT_PIXEL_BYTES; i++)
+        if (px[i] != px[0])
+            return 0;
+    return 1;
+}
+
+// Acompanha o ponteiro de escrita do controlador após n pixels na janela
+static void winAdvance(uint32_t n)
+{
+    uint16_t w = tft.win.x2 - tft.win.x1 + 1;
+    uint16_t h = tft.win.y2 - tft.win.y1 + 1;
+    uint32_t pos;
+
+    if (!tft.win.valid)
+        return;
+    pos = (uint32_t)(tft.win.page - tft.win.y1) * w + (tft.win.col - tft.win.x1) + n;
+    tft.win.col  = tft.win.x1 + pos % w;
+    tft.win.page = tft.win.y1 + (pos / w) % h;
+}
+
+// Camada de transporte: todas as escritas no display passam pelas funções
+// abaixo, que usam a fila de interrupção (TFT_SPI_QUEUE = 1) ou escrevem
+// diretamente no SPI (TFT_SPI_QUEUE = 0).
+#if TFT_SPI_QUEUE
+
+// Chamada pelo ISR da fila no início de cada segmento
+static void tftPins(uint8_t flags)
+{
+    if (flags & SPIQ_BEGIN)
+        pinCS(1);
+    else if (flags & SPIQ_END)
+        pinCS(0);
+    else
+        pinDC(flags & SPIQ_DATA);
+}
+
+static void tftSelect(uint8_t active)
+{
+    spiQueuePush(0, 0, 0, active ? SPIQ_BEGIN : SPIQ_END);
+}
+
+static void tftCmd(uint8_t cmd)
+{
+    spiQueuePush(&cmd, 1, 1, 0);
+}
+
+// Blocos maiores que 4 bytes não são copiados: buf deve viver até tftFlush()
+static void tftData(const uint8_t * buf, uint8_t n)
+{
+    spiQueuePush(buf, n, 1, SPIQ_DATA);
+}
+
+// Envia count pixels de cor px (já codificada) na janela aberta por Address_set
+static void tftFill(const uint8_t * px, uint32_t count)
+{
+    uint16_t n;
+
+    winAdvance(count);
+    if (tftUniform(px)) {
+        count *= TFT_PIXEL_BYTES;   // Cor de byte único: o ISR entrega o segmento ao DMA
+        while (count) {
+            n = count > 0xFFFF ? 0xFFFF : count;
+            spiQueuePush(px, 1, n, SPIQ_DATA);
+            count -= n;
+        }
+    } else {
+        while (count) {
+            n = count > 0xFFFF ? 0xFFFF : count;
+            spiQueuePush(px, TFT_PIXEL_BYTES, n, SPIQ_DATA);
+            count -= n;
+        }
+    }
+}
+
+void tftFlush()
+{
+    spiQueueFlush();       // Dorme em LPM0 até o último byte sair
+}
+
+#else
+
+static void tftSelect(uint8_t active)
+{
+    pinCS(active);
+}
+
+static void tftCmd(uint8_t cmd)
+{
+    pinDC(0);              // Modo Comando (DC = 0)
+    spiWriteBurst(&cmd, 1);
+}
+
+static void tftData(const uint8_t * buf, uint8_t n)
+{
+    pinDC(1);              // Modo Dados (DC = 1)
+    spiWriteBurst(buf, n);
+}
+
+// Envia count pixels de cor px (já codificada) na janela aberta por Address_set.
+// Poucos pixels vão por spiWriteRepeat; os demais por DMA: cores com todos os
+// bytes iguais (branco, preto, cinzas) usam fonte fixa e blocos de até 0xFFFF
+// bytes, as demais repetem o buffer fillBuf.
+static void tftFill(const uint8_t * px, uint32_t count)
+{
+    uint16_t i, n;
+    uint8_t fixed = tftUniform(px);
+
+    winAdvance(count);
+    for (i = 0; i < sizeof(fillBuf); i++)
+        fillBuf[i] = px[i % TFT_PIXEL_BYTES];
+
+    pinDC(1);              // Modo Dados durante todo o fluxo de pixels
+    if (count < FILL_DMA_MIN) {
+        spiWriteRepeat(fillBuf, TFT_PIXEL_BYTES, count);
+        count = 0;
+    }
+    while (count) {
+        n = fixed ? 0xFFFF / TFT_PIXEL_BYTES : FILL_PIXELS;
+        if (count < n)
+            n = count;
+        spiDmaStart(fillBuf, n * TFT_PIXEL_BYTES, fixed);
+        count -= n;
+        spiDmaWait();      // A CPU não toca nos bytes; apenas aguarda o bloco
+    }
+}
+
+void tftFlush()
+{
+}
+
+#endif // TFT_SPI_QUEUE
+
+void tftBegin()
+{
+    while (tft.initPc && !tftInitPoll())
+        delayUntil(tft.initStart + tft.initWait);   // Desenho antes do fim da inicialização
+    if (tft.depth++ == 0)
+        tftSelect(1);      // Só a sessão mais externa ativa o CS
+    else
+        tft.st.gpioSaved++;
+}
+
+void tftEnd()
+{
+    if (--tft.depth == 0)
+        tftSelect(0);
+    else
+        tft.st.gpioSaved++;
+}
+
+void tftTakeStats(TftStats * st)
+{
+    *st = tft.st;
+    tft.st.gpioWrites = 0;
+    tft.st.gpioSaved  = 0;
+    tft.st.addrSaved  = 0;
+    tft.st.glyphHits   = 0;
+    tft.st.glyphMisses = 0;
+}
 
 
 void tftConfig()
 {
     spiConfig(1, 0);       // Configura o SPI no modo mestre (1) e desabilita interrupções (0)
+#if TFT_SPI_QUEUE
+    spiQueueConfig(tftPins);   // O ISR da fila controla CS e DC
+    __enable_interrupt();      // A fila só anda com o GIE ligado
+#endif
     CSDIR  |= CSBIT;       // Define o pino CS (Chip Select) como saída
     CSOUT  |= CSBIT;       // Inicializa CS em nível alto (desativado)
+    tft.cs = 0;
     RSTDIR |= RSTBIT;      // Define o pino RST (Reset) como saída
     RSTOUT |= RSTBIT;      // Inicializa RST em nível alto (desativado)
     DCDIR  |= DCBIT;       // Define o pino DC (Data/Command) como saída
     DCOUT  |= DCBIT;       // Inicializa DC em nível alto (modo Data)
+    tft.dc = 1;
     LEDDIR |= LEDBIT;      // Define o pino LED como saída
     LEDOUT |= LEDBIT;      // Liga o LED do display
-    tftInitSeq();          // Executa a sequência de inicialização do display
+#if TFT_GLYPH_CACHE
+    gcache.used = 0;       // A USBRAM não é inicializada no boot
+#endif
+    tftInitStart();        // Inicia a sequência de inicialização do display
 }
 
 
+// Sequência de inicialização do ILI9341 como programa de bytes: cada entrada
+// é cmd, n, os n bytes de argumento e, se n tem INIT_WAIT, a espera em ms
+// antes da entrada seguinte. INIT_RST não é comando do display: o argumento
+// é o nível do pino RST.
+#define INIT_WAIT 0x80
+#define INIT_RST  0xFE
+#define INIT_END  0xFF
+
+static const uint8_t tftInitProg[] = {
+    INIT_RST, 1 | INIT_WAIT, 0, 15,         // Ciclo de RESET: 15 ms em nível baixo
+    INIT_RST, 1 | INIT_WAIT, 1, 15,         // e mais 15 ms até o primeiro comando
+    0xCB, 5, 0x39, 0x2C, 0x00, 0x34, 0x02,
+    0xCF, 3, 0x00, 0xC1, 0x30,
+    0xE8, 3, 0x85, 0x00, 0x78,
+    0xEA, 2, 0x00, 0x00,
+    0xED, 4, 0x64, 0x03, 0x12, 0x81,
+    0xF7, 1, 0x20,
+    0xC0, 1, 0x23,
+    0xC1, 1, 0x10,
+    0xC5, 2, 0x3E, 0x28,
+    0xC7, 1, 0x86,
+    0x36, 1, TFT_MADCTL,                    // Modo de orientação da tela
+    0x3A, 1, TFT_COLMOD,                    // Formato de pixel (RGB565 ou RGB666)
+    0xB1, 2, 0x00, 0x18,
+    0xB6, 3, 0x08, 0x82, 0x27,
+    0x11, 0 | INIT_WAIT, 120,               // Sai do modo sleep
+    0x29, 0,                                // Liga o display
+    0x2C, 0,                                // Modo de escrita de memória
+    INIT_END
+};
+
+void tftInitStart()
+{
+    tft.initPc = tftInitProg;
+    tft.initStart = timeNow();
+    tft.initWait  = 0;
+    tft.win.valid = 0;     // O reset apaga a janela programada
+    tftInitPoll();
+}
+
+// Executa as entradas até a próxima espera ainda não vencida. Os argumentos
+// de cada comando vão num único bloco, lidos direto da flash.
+uint8_t tftInitPoll()
+{
+    const uint8_t * pc = tft.initPc;
+    uint8_t cmd, n, session = 0;
+
+    if (!pc || !timeElapsed(tft.initStart, tft.initWait))
+        return !pc;
+    tft.initPc = 0;        // O tftBegin() abaixo não reentra na sequência
+    while ((cmd = *pc++) != INIT_END) {
+        n = *pc++;
+        if (cmd == INIT_RST) {
+            if (*pc)
+                RSTOUT |=  RSTBIT; // Desativa o reset (nível alto)
+            else
+                RSTOUT &= ~RSTBIT; // Ativa o reset (nível baixo)
+        } else {
+            if (!session) {
+                tftBegin();
+                session = 1;
+            }
+            tftCmd(cmd);
+            if (n & ~INIT_WAIT)
+                tftData(pc, n & ~INIT_WAIT);
+        }
+        pc += n & ~INIT_WAIT;
+        if (n & INIT_WAIT) {
+            tft.initPc = pc + 1;
+            break;
+        }
+    }
+    if (session)
+        tftEnd();          // CS fica livre durante a espera
+    tftFlush();            // A espera conta do fim do último comando
+    if (tft.initPc) {
+        tft.initStart = timeNow();
+        tft.initWait  = TIME_MS(*pc);
+    }
+    return !tft.initPc;
+}
+
 void tftInitSeq()
 {
-    // Ciclo de RESET
-    RSTOUT &= ~RSTBIT;     // Ativa o reset (nível baixo)
-    delay(15);             // Aguarda 15ms
-    RSTOUT |=  RSTBIT;     // Desativa o reset (nível alto)
-    delay(15);             // Aguarda mais 15ms
-
-    // Habilita o chip selecionando-o (CS em nível baixo)
-    CSOUT &= ~CSBIT;
-
-    // Envia uma série de comandos e dados para configurar o display
-    sWcmd(0xCB); sWdata(0x39); sWdata(0x2C); sWdata(0x00); sWdata(0x34); sWdata(0x02);
-    sWcmd(0xCF); sWdata(0x00); sWdata(0xC1); sWdata(0x30);
-    sWcmd(0xE8); sWdata(0x85); sWdata(0x00); sWdata(0x78);
-    sWcmd(0xEA); sWdata(0x00); sWdata(0x00);
-    sWcmd(0xED); sWdata(0x64); sWdata(0x03); sWdata(0x12); sWdata(0x81);
-    sWcmd(0xF7); sWdata(0x20);
-    sWcmd(0xC0); sWdata(0x23);
-    sWcmd(0xC1); sWdata(0x10);
-    sWcmd(0xC5); sWdata(0x3E); sWdata(0x28);
-    sWcmd(0xC7); sWdata(0x86);
-    sWcmd(0x36); sWdata(0x28); // Modo de orientação da tela
-    sWcmd(0x3A); sWdata(0x66); // Formato de pixel
-    sWcmd(0xB1); sWdata(0x00); sWdata(0x18);
-    sWcmd(0xB6); sWdata(0x08); sWdata(0x82); sWdata(0x27);
-    sWcmd(0x11); delay(120);   // Sai do modo sleep
-    sWcmd(0x29);               // Liga o display
-    sWcmd(0x2C);               // Modo de escrita de memória
-
-    // Desabilita o chip (CS em nível alto)
-    CSOUT |= CSBIT;
+    tftInitStart();
+    while (!tftInitPoll())
+        delayUntil(tft.initStart + tft.initWait);
 }
 
 void tftWrite(uint8_t cmd, uint8_t * data, uint8_t nData)
 {
-    CSOUT &= ~CSBIT;       // Habilita o chip (CS em nível baixo)
-    DCOUT &= ~DCBIT;       // Define o modo Comando (DC = 0)
-    spiTransfer(cmd);      // Envia o comando
-    DCOUT |= DCBIT;        // Define o modo Dados (DC = 1)
-    while(nData--)         // Envia todos os bytes de dados
-        spiTransfer(data[nData]);
-    CSOUT |= CSBIT;        // Desabilita o chip (CS em nível alto)
+    tft.win.valid = 0;     // O comando pode mexer na janela ou no ponteiro
+    tftBegin();            // Habilita o chip (CS em nível baixo)
+    tftCmd(cmd);           // Envia o comando (DC = 0)
+    while (nData--)        // Envia os dados do último para o primeiro, na
+        tftData(&data[nData], 1);  // mesma ordem em que tftRead os preenche
+    tftEnd();              // Desabilita o chip (CS em nível alto)
 }
 
 
 void tftRead(uint8_t cmd, uint8_t * data, uint8_t nData)
 {
-    CSOUT &= ~CSBIT;       // Habilita o chip (CS em nível baixo)
-    DCOUT &= ~DCBIT;       // Define o modo Comando (DC = 0)
+    tftFlush();            // A leitura usa o SPI diretamente
+    tft.win.valid = 0;     // RAMRD (0x2E) e afins movem o ponteiro da GRAM
+    pinCS(1);              // Habilita o chip (CS em nível baixo)
+    pinDC(0);              // Define o modo Comando (DC = 0)
     spiTransfer(cmd);      // Envia o comando
     spiTransfer(DUMMY);    // Transfere um byte fictício
-    DCOUT |= DCBIT;        // Define o modo Dados (DC = 1)
+    pinDC(1);              // Define o modo Dados (DC = 1)
     while(nData--)         // Lê todos os bytes de dados
         data[nData] = spiTransfer(DUMMY);
-    CSOUT |= CSBIT;        // Desabilita o chip (CS em nível alto)
+    if (!tft.depth)
+        pinCS(0);          // Desabilita o chip, salvo dentro de uma sessão
 }
 
 void sWcmd(uint8_t byte)
 {
-    DCOUT &= ~DCBIT;       // Define o modo Comando (DC = 0)
-    spiTransfer(byte);     // Envia o comando
+    tft.win.valid = 0;     // Comandos avulsos invalidam a janela conhecida
+    tftCmd(byte);          // Envia o comando (DC = 0)
 }
 
 void sWdata(uint8_t byte)
 {
-    DCOUT |= DCBIT;        // Define o modo Dados (DC = 1)
-    spiTransfer(byte);     // Envia o dado
-    DCOUT &= ~DCBIT;       // Retorna ao modo Comando (DC = 0)
+    tft.win.valid = 0;     // Pixels avulsos movem o ponteiro sem passar por winAdvance
+    tftData(&byte, 1);     // Envia o dado (DC = 1)
 }
 
+// Troca a orientação de escrita (MADCTL); a janela programada deixa de valer
+static void tftMadctl(uint8_t mode)
+{
+    tftCmd(0x36);
+    tftData(&mode, 1);     // Um byte: copiado para a fila
+    tft.win.valid = 0;
+}
+
+// Só reenvia as fases que mudaram em relação à janela já programada. Se a
+// nova janela começa exatamente onde a escrita anterior parou, usa Memory
+// Write Continue (0x3C) sem reprogramar nada.
 void Address_set(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
 {
-    sWcmd(0x2a);           // Define a área X (colunas)
-    sWdata(x1 >> 8); sWdata(x1);
-    sWdata(x2 >> 8); sWdata(x2);
-    sWcmd(0x2b);           // Define a área Y (linhas)
-    sWdata(y1 >> 8); sWdata(y1);
-    sWdata(y2 >> 8); sWdata(y2);
-    sWcmd(0x2c);           // Modo de escrita de memória
+    uint8_t col[4]  = { x1 >> 8, x1, x2 >> 8, x2 };
+    uint8_t page[4] = { y1 >> 8, y1, y2 >> 8, y2 };
+
+    if (tft.win.valid && x1 == tft.win.x1 && x2 == tft.win.x2 && y2 == tft.win.y2
+            && y1 >= tft.win.y1 && tft.win.col == x1 && tft.win.page == y1) {
+        tftCmd(0x3c);      // Continua a escrita de memória a partir do ponteiro atual
+        tft.st.addrSaved += 10;
+        return;
+    }
+
+    if (!tft.win.valid || x1 != tft.win.x1 || x2 != tft.win.x2) {
+        tftCmd(0x2a);      // Define a área X (colunas)
+        tftData(col, 4);
+        tft.win.x1 = x1;
+        tft.win.x2 = x2;
+    } else {
+        tft.st.addrSaved += 5;
+    }
+    if (!tft.win.valid || y1 != tft.win.y1 || y2 != tft.win.y2) {
+        tftCmd(0x2b);      // Define a área Y (linhas)
+        tftData(page, 4);
+        tft.win.y1 = y1;
+        tft.win.y2 = y2;
+    } else {
+        tft.st.addrSaved += 5;
+    }
+    tftCmd(0x2c);          // Modo de escrita de memória
+    tft.win.valid = 1;
+    tft.win.col   = x1;
+    tft.win.page  = y1;
+}
+
+void draw_pixel(tft_color_t color)
+{
+    uint8_t px[TFT_PIXEL_BYTES];
+
+    tftBytes(color, px);
+    tftData(px, TFT_PIXEL_BYTES);  // Envia o pixel no formato do barramento
+    winAdvance(1);
+}
+
+// Um pixel com a cor já codificada (a conversão fica fora dos laços)
+static void tftPlot(uint16_t x, uint16_t y, const uint8_t * px)
+{
+    Address_set(x, y, x, y);
+    tftData(px, TFT_PIXEL_BYTES);
+    winAdvance(1);
 }
 
-void draw_pixel(uint16_t cr, uint16_t cg, uint16_t cb)
+// Retângulo com a cor já codificada, dentro de uma sessão aberta
+static void tftRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint8_t * px)
 {
-    sWdata(cr); sWdata(cg); sWdata(cb); // Envia os valores RGB do pixel
+    Address_set(x, y, x + w - 1, y + h - 1);
+    tftFill(px, (uint32_t)w * h);
+}
+
+// Preenche o retângulo de w x h pixels com canto superior esquerdo em (x, y):
+// uma única janela (limites inclusivos) e um único fluxo de pixels
+void fillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, tft_color_t color)
+{
+    uint8_t px[TFT_PIXEL_BYTES];
+
+    if (!w || !h)
+        return;
+    tftBytes(color, px);
+    tftBegin();            // Habilita o chip
+    tftRect(x, y, w, h, px);
+    tftEnd();              // Desabilita o chip
+}
+
+// Linhas horizontais/verticais: uma janela de 1 pixel de altura/largura e um
+// único fluxo, em vez de um Address_set por pixel
+void drawHLine(uint16_t x, uint16_t y, uint16_t w, tft_color_t color)
+{
+    fillRect(x, y, w, 1, color);
+}
+
+void drawVLine(uint16_t x, uint16_t y, uint16_t h, tft_color_t color)
+{
+    fillRect(x, y, 1, h, color);
+}
+
+// Contorno de w x h pixels montado com quatro linhas, sem repetir os cantos
+void drawFrame(uint16_t x, uint16_t y, uint16_t w, uint16_t h, tft_color_t color)
+{
+    if (!w || !h)
+        return;
+    tftBegin();            // Um único CS para as quatro linhas
+    drawHLine(x, y, w, color);
+    if (h > 1)
+        drawHLine(x, y + h - 1, w, color);
+    if (h > 2) {
+        drawVLine(x, y + 1, h - 2, color);
+        if (w > 1)
+            drawVLine(x + w - 1, y + 1, h - 2, color);
+    }
+    tftEnd();
 }
 
 void drawRect(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
 {
-    uint16_t ii,mm;
-	CSOUT &= ~CSBIT;       // Habilita o chip
-	Address_set(x1, y1, x2, y2); // Define a área
-    for(ii = 0; ii < (x2 - x1); ii++)
-        for(mm = 0; mm < (y2 - y1); mm++)
-            draw_pixel(0, 0xFFFF, 0); // Preenche com cor (verde)
-    CSOUT |= CSBIT;        // Desabilita o chip
-}
-
-void LCD_Clear(uint16_t cr, uint16_t cg, uint16_t cb, int screen_orientation)
-{
-	uint16_t ii,mm;
-    
-	CSOUT &= ~CSBIT;       // Habilita o chip
-	if (!screen_orientation) {
-		Address_set(0, 0, 240, 320); // Orientação retrato
-		for(ii = 0; ii < 240; ii++)
-			for(mm = 0; mm < 320; mm++)
-				draw_pixel(cr, cg, cb); // Preenche com cor
-	} else {
-		Address_set(0, 0, 320, 240); // Orientação paisagem
-		for(ii = 0; ii < 320; ii++)
-			for(mm = 0; mm < 240; mm++)
-				draw_pixel(cr, cg, cb); // Preenche com cor
-	}
-	CSOUT |= CSBIT;        // Desabilita o chip
+    fillRect(x1, y1, x2 - x1 + 1, y2 - y1 + 1, TFT_GREEN);   // Cantos inclusivos, verde
+}
+
+void LCD_Clear(tft_color_t color, int screen_orientation)
+{
+    if (!screen_orientation)
+        fillRect(0, 0, 240, 320, color);   // Orientação retrato
+    else
+        fillRect(0, 0, 320, 240, color);   // Orientação paisagem
 }
 
 void LCD_Arc()
@@ -143,7 +547,7 @@ void LCD_Arc()
     uint8_t ii,mm;
     uint16_t cb = 0, cg = 0, cr = 0;
     // Enable CS
-    CSOUT &= ~CSBIT;
+    tftBegin();
 
     Address_set(0,0,240,320);
     for(ii=0;ii<320;ii++) {
@@ -154,104 +558,686 @@ void LCD_Arc()
         for(mm=0;mm<240;mm++)
         {
             cg = mm%240;
-            draw_pixel(cr, cg, cb);
+            draw_pixel(TFT_RGB(cr, cg, cb));
         }
     }
     // Disable CS
-    CSOUT |=  CSBIT;
+    tftEnd();
 }
 
 void LCD_Carre()
 {
     uint8_t ii;
     // Enable CS
-    CSOUT &= ~CSBIT;
+    tftBegin();
 
     Address_set(10,10,20,20);
     for(ii=0;ii<100;ii++) {
-      draw_pixel(0xff, 0xff, 0xff);
+      draw_pixel(TFT_WHITE);
     }
     // Disable CS
-    CSOUT |=  CSBIT;
+    tftEnd();
+}
+
+// Trecho vertical de bits acesos numa coluna do glifo
+typedef struct {
+    uint8_t r0, len;       // Primeira linha e altura
+    uint8_t x0;            // Coluna onde o retângulo começou
+} VRun;
+
+// Retângulos abertos do desenho transparente de um glifo em (x, y)
+typedef struct {
+    uint16_t x, y;
+    const uint8_t * px;
+    VRun    open[SPAN_MAX];
+    uint8_t nOpen;
+} Rects;
+
+// Recebe os trechos da coluna col: trechos idênticos aos da coluna anterior
+// fazem o retângulo crescer, os demais retângulos abertos são desenhados.
+// Cada retângulo custa uma janela.
+static void rectsColumn(Rects * r, uint8_t col, VRun * cur, uint8_t nCur)
+{
+    uint8_t i, j;
+
+    for (i = 0; i < r->nOpen; i++) {
+        for (j = 0; j < nCur; j++)
+            if (cur[j].r0 == r->open[i].r0 && cur[j].len == r->open[i].len)
+                break;
+        if (j < nCur)
+            cur[j].x0 = r->open[i].x0;      // Mesmo trecho: o retângulo cresce
+        else
+            tftRect(r->x + r->open[i].x0, r->y + r->open[i].r0,
+                    col - r->open[i].x0, r->open[i].len, r->px);
+    }
+    for (i = 0; i < nCur; i++)
+        r->open[i] = cur[i];
+    r->nOpen = nCur;
 }
 
-void drawChar(uint16_t x, uint16_t y, char c, uint16_t cr, uint16_t cg, uint16_t cb)
+// Desenho transparente sem um Address_set por pixel: cada coluna (bit 0 =
+// linha de cima) é decomposta em trechos verticais de bits acesos
+static void glyphSpans(uint16_t x, uint16_t y, const uint32_t * cols, uint8_t nCols,
+                       uint8_t nRows, const uint8_t * px)
 {
-    uint8_t col, row;
+    Rects r;
+    VRun cur[SPAN_MAX];
+    uint8_t nCur, col, row;
+    uint32_t m;
 
-    for (col = 0; col < 5; col++) {
-        uint8_t line = font5x7[c][col]; // Ajustando indice do caractere
-        for (row = 0; row < 7; row++) {
-            if (line & (1 << row)) {
-                drawPixel(x + col, y + row, cr, cg, cb);
+    r.x = x;
+    r.y = y;
+    r.px = px;
+    r.nOpen = 0;
+    for (col = 0; col <= nCols; col++) {
+        m = col < nCols ? cols[col] : 0;    // Coluna extra vazia fecha os retângulos
+        nCur = 0;
+        for (row = 0; row < nRows; ) {
+            if (!((m >> row) & 1)) {
+                row++;
+                continue;
             }
+            cur[nCur].r0 = row;
+            while (row < nRows && ((m >> row) & 1))
+                row++;
+            cur[nCur].len = row - cur[nCur].r0;
+            cur[nCur].x0  = col;
+            nCur++;
         }
+        rectsColumn(&r, col, cur, nCur);
     }
 }
 
-void drawString(uint16_t x, uint16_t y, const char *str, uint16_t cr, uint16_t cg, uint16_t cb)
+// Trechos RLE do glifo de c na fonte 20x28 (vazio fora de ' '..DEL)
+static const uint8_t * bigGlyph(char c, const uint8_t ** end)
 {
-    while (*str) {
-        drawChar(x, y, *str, cr, cg, cb);
-        x += 6; // Espacamento entre caracteres (5 pixels + 1 de espaco)
-        str++;
+    uint8_t k = (uint8_t)c - FONT20X28_FIRST;
+
+    if (k >= FONT20X28_COUNT) {
+        *end = font20x28Rle;
+        return font20x28Rle;
     }
+    *end = font20x28Rle + font20x28Idx[k + 1];
+    return font20x28Rle + font20x28Idx[k];
 }
 
-void drawPixel(uint16_t x, uint16_t y, uint16_t cr, uint16_t cg, uint16_t cb)
+// Transparente a partir do RLE: os trechos de frente já são trechos verticais
+// (cortados nas trocas de coluna), sem testar bit a bit
+static void rleSpans(uint16_t x, uint16_t y, const uint8_t * rle, const uint8_t * end,
+                     const uint8_t * px)
 {
-    // Enable CS
-    CSOUT &= ~CSBIT;
+    Rects r;
+    VRun cur[SPAN_MAX];
+    uint8_t nCur = 0, col = 0, row = 0, on = 0, take;
+    uint16_t n;
 
-    Address_set(x, y, x, y);
-    draw_pixel(cr, cg, cb);
+    r.x = x;
+    r.y = y;
+    r.px = px;
+    r.nOpen = 0;
+    for (; rle < end; rle++, on ^= 1) {
+        for (n = *rle; n; n -= take) {
+            take = FONT20X28_H - row;
+            if (take > n)
+                take = n;
+            if (on && nCur && cur[nCur - 1].r0 + cur[nCur - 1].len == row)
+                cur[nCur - 1].len += take;  // Continuação de um trecho dividido
+            else if (on) {
+                cur[nCur].r0  = row;
+                cur[nCur].len = take;
+                cur[nCur].x0  = col;
+                nCur++;
+            }
+            row += take;
+            if (row == FONT20X28_H) {
+                rectsColumn(&r, col++, cur, nCur);
+                nCur = 0;
+                row  = 0;
+            }
+        }
+    }
+    for (; col <= FONT20X28_W; col++) {     // Fundo implícito e coluna que fecha tudo
+        rectsColumn(&r, col, cur, nCur);
+        nCur = 0;
+    }
+}
 
-    // Disable CS
-    CSOUT |=  CSBIT;
+void drawChar(uint16_t x, uint16_t y, char c, tft_color_t color)
+{
+    uint8_t col;
+    uint8_t px[TFT_PIXEL_BYTES];
+    uint32_t cols[GLYPH_COLS];
+
+    for (col = 0; col < GLYPH_COLS; col++)
+        cols[col] = FONT5X7(c)[col];   // Bit 0 = linha de cima
+    tftBytes(color, px);
+    tftBegin(); // Um único CS para todos os trechos do caractere
+    glyphSpans(x, y, cols, GLYPH_COLS, GLYPH_H, px);
+    tftEnd();
+}
+
+// Trechos consecutivos de pixels da mesma cor: cada mudança de cor fecha o
+// trecho anterior com um único tftFill. px[0] é o fundo e px[1] a frente; o
+// texto anti-aliased usa os quatro níveis.
+typedef struct {
+    const uint8_t * px[4];
+    uint8_t  on;           // Cor do trecho aberto (índice em px)
+    uint16_t n;            // Pixels acumulados no trecho aberto
+} Span;
+
+static void spanRun(Span * s, uint8_t on, uint16_t n)
+{
+    if (on != s->on && s->n) {
+        tftFill(s->px[s->on], s->n);
+        s->n = 0;
+    }
+    s->on = on;
+    s->n += n;
+}
+
+static void spanEnd(Span * s)
+{
+    if (s->n)
+        tftFill(s->px[s->on], s->n);
+    s->n = 0;
 }
 
-void drawChar_4x(uint16_t x, uint16_t y, char c, uint16_t cr, uint16_t cg, uint16_t cb)
+// Caracteres (não bytes) de um texto UTF-8
+static uint16_t utf8Len(const char * str)
 {
-    uint16_t col, row;
-    
-//    CSOUT &= ~CSBIT; // Habilita CS para toda a escrita do caractere
+    uint16_t n = 0;
 
-    for (col = 0; col < 20; col++) {
-        uint32_t line = font20x28[c - 32][col]; // Obtém os dados da coluna do caractere
+    for (; *str; n++)
+        utf8Next(&str);
+    return n;
+}
 
-        // Parte superior (0 a 13)
-        for (row = 0; row < 14; row++) {
-            if (line & (1 << (27 - row))) {
-                drawPixel(x + col, y + row, cr, cg, cb);
+#if TFT_GLYPH_CACHE
+// Devolve a célula de c nas cores color/bg, codificando-a numa entrada livre
+// ou na menos usada em caso de falta
+static const uint8_t * glyphCached(uint8_t c, tft_color_t color, tft_color_t bg)
+{
+    uint8_t fg[TFT_PIXEL_BYTES], bk[TFT_PIXEL_BYTES];
+    uint8_t i, slot, col, row, k;
+    const uint8_t * glyph;
+    const uint8_t * src;
+    uint8_t * p;
+
+    for (i = 0; i < gcache.used; i++) {
+        slot = gcache.order[i];
+        if (gcache.c[slot] == c && gcache.fg[slot] == color && gcache.bg[slot] == bg)
+            break;
+    }
+    if (i < gcache.used) {
+        tft.st.glyphHits++;
+    } else {
+        tft.st.glyphMisses++;
+        if (gcache.used < TFT_GLYPH_CACHE) {
+            slot = gcache.used++;
+        } else {
+            slot = gcache.order[--i];
+            tftFlush();            // A fila ainda pode apontar para a entrada descartada
+        }
+        gcache.c[slot]  = c;
+        gcache.fg[slot] = color;
+        gcache.bg[slot] = bg;
+        tftBytes(color, fg);
+        tftBytes(bg, bk);
+        glyph = FONT5X7(c);
+        p = gcache.px[slot];
+#if TFT_TEXT_COLUMNS
+        for (col = 0; col < GLYPH_W; col++)
+            for (row = 0; row < GLYPH_H; row++) {
+#else
+        for (row = 0; row < GLYPH_H; row++)
+            for (col = 0; col < GLYPH_W; col++) {
+#endif
+                src = col < GLYPH_COLS && (glyph[col] & (1 << row)) ? fg : bk;
+                for (k = 0; k < TFT_PIXEL_BYTES; k++)
+                    *p++ = src[k];
             }
+    }
+    for (; i; i--)                 // Move a entrada para o início da lista
+        gcache.order[i] = gcache.order[i - 1];
+    gcache.order[0] = slot;
+    return gcache.px[slot];
+}
+#endif // TFT_GLYPH_CACHE
+
+// Envia n células opacas de 6x8 a partir de (x, y), numa única janela
+// (oneWindow = 1) ou numa janela por caractere.
+#if TFT_TEXT_COLUMNS
+// A font5x7 é guardada por colunas: com MV desligado no MADCTL a escrita na
+// GRAM desce pelas colunas da tela em paisagem, então cada byte da fonte é
+// enviado como está, bit 0 primeiro, sem transpor o bitmap. CASET passa a
+// endereçar y e PASET x; a orientação de tftInitSeq é restaurada no fim.
+// Com o cache de glifos cada célula sai inteira como um só bloco.
+static void glyphCells(uint16_t x, uint16_t y, const char * str, uint16_t n,
+                       tft_color_t color, tft_color_t bg, uint8_t oneWindow)
+{
+    uint8_t fg[TFT_PIXEL_BYTES], bk[TFT_PIXEL_BYTES];
+    Span sp = { { bk, fg }, 0, 0 };
+    uint8_t c;
+#if !TFT_GLYPH_CACHE
+    uint8_t col, row, line;
+    const uint8_t * glyph;
+#endif
+
+    tftBytes(color, fg);
+    tftBytes(bg, bk);
+    tftMadctl(MADCTL_COLS);
+    if (oneWindow)
+        Address_set(y, x, y + GLYPH_H - 1, x + n * GLYPH_W - 1);
+    for (; n; n--, x += GLYPH_W) {
+        c = utf8Next(&str);
+        if (!oneWindow) {
+            spanEnd(&sp);
+            Address_set(y, x, y + GLYPH_H - 1, x + GLYPH_W - 1);
         }
+#if TFT_GLYPH_CACHE
+        tftData(glyphCached(c, color, bg), CELL_BYTES);
+#else
+        glyph = FONT5X7(c);
+        for (col = 0; col < GLYPH_COLS; col++) {
+            line = glyph[col];
+            for (row = 0; row < GLYPH_H; row++, line >>= 1)
+                spanRun(&sp, line & 1, 1);
+        }
+        spanRun(&sp, 0, GLYPH_H);           // Coluna de espaçamento
+#endif
+    }
+    spanEnd(&sp);
+    tftMadctl(TFT_MADCTL);
+}
+#else
+// Varredura por linhas: para cada linha percorre o bitmap de todos os
+// caracteres da janela. Com o cache de glifos, as janelas de um caractere
+// saem como um só bloco.
+static void glyphCells(uint16_t x, uint16_t y, const char * str, uint16_t n,
+                       tft_color_t color, tft_color_t bg, uint8_t oneWindow)
+{
+    uint8_t fg[TFT_PIXEL_BYTES], bk[TFT_PIXEL_BYTES];
+    Span sp = { { bk, fg }, 0, 0 };
+    uint8_t col, row, c;
+    uint16_t i, w = oneWindow ? n : 1;
+    const char * p = str;
+    const uint8_t * glyph;
 
-        // Parte inferior (14 a 27)
-        for (row = 14; row < 28; row++) {
-            if (line & (1 << (27 - row))) {
-                drawPixel(x + col, y + row, cr, cg, cb);
+    tftBytes(color, fg);
+    tftBytes(bg, bk);
+    for (; n; n -= w, str = p, x += w * GLYPH_W) {
+        spanEnd(&sp);
+        Address_set(x, y, x + w * GLYPH_W - 1, y + GLYPH_H - 1);
+#if TFT_GLYPH_CACHE
+        if (w == 1) {
+            tftData(glyphCached(utf8Next(&p), color, bg), CELL_BYTES);
+            continue;
+        }
+#endif
+        for (row = 0; row < GLYPH_H; row++) {
+            for (i = 0, p = str; i < w; i++) {   // Cada linha decodifica a janela de novo
+                c = utf8Next(&p);
+                glyph = FONT5X7(c);
+                for (col = 0; col < GLYPH_W; col++)
+                    spanRun(&sp, col < GLYPH_COLS && (glyph[col] & (1 << row)), 1);
             }
         }
     }
-
-//    CSOUT |= CSBIT; // Desabilita CS após escrever o caractere
+    spanEnd(&sp);
 }
+#endif
 
+// Modo opaco: uma janela de 6x8 por caractere, com a cor de fundo bg
+void drawCharOpaque(uint16_t x, uint16_t y, char c, tft_color_t color, tft_color_t bg)
+{
+    char s[2] = { c, 0 };  // Sozinho, um byte acima de 0x7F é Latin-1
 
-void drawString_4x(uint16_t x, uint16_t y, const char *str, uint16_t cr, uint16_t cg, uint16_t cb)
+    tftBegin();
+    glyphCells(x, y, s, 1, color, bg, 1);
+    tftEnd();
+}
+
+void drawString(uint16_t x, uint16_t y, const char *str, tft_color_t color)
 {
+    tftBegin(); // Um único CS para toda a string
     while (*str) {
-        drawChar_4x(x, y, *str, cr, cg, cb);
-        x += 21; // Espacamento entre caracteres (20 pixels + 1 de espaco)
-        str++;
+        drawChar(x, y, utf8Next(&str), color);
+        x += GLYPH_W; // Espacamento entre caracteres (5 pixels + 1 de espaco)
     }
+    tftEnd();
 }
 
+void drawStringOpaque(uint16_t x, uint16_t y, const char *str, tft_color_t color, tft_color_t bg)
+{
+    uint16_t n = utf8Len(str);
 
+    tftBegin(); // Um único CS para toda a string
+    if (n)
+        glyphCells(x, y, str, n, color, bg, 0);
+    tftEnd();
+}
 
+// Uma única janela cobrindo a string inteira (6n x 8). Mesmas coordenadas e
+// espaçamento de drawString, sempre opaco.
+void drawStringLine(uint16_t x, uint16_t y, const char *str, tft_color_t color, tft_color_t bg)
+{
+    uint16_t n = utf8Len(str);
 
+    if (!n)
+        return;
+    tftBegin();
+    glyphCells(x, y, str, n, color, bg, 1);
+    tftEnd();
+}
 
+// Texto opaco com qualquer tabela sFONT (Font8 a Font48): glifos de Width x
+// Height guardados por linhas, (Width + 7) / 8 bytes por linha, bit 7 à
+// esquerda, a partir do caractere ' '. Caracteres fora de ' '..'~' (ou fora
+// do subconjunto, com FONT_SUBSET) viram espaço.
+void drawStringFont(uint16_t x, uint16_t y, const char *str, const sFONT *font,
+                    tft_color_t color, tft_color_t bg)
+{
+    drawStringScaled(x, y, str, font, 1, color, bg);
+}
 
+// font5x7 em células de 6x8 para drawStringScaled
+static void scaled5x7(Span * sp, const char *str, uint8_t scale)
+{
+    const char * p;
+    const uint8_t * line;
+    uint8_t row, rep, col, c;
 
+    for (row = 0; row < GLYPH_H; row++)
+        for (rep = 0; rep < scale; rep++)
+            for (p = str; *p; ) {
+                c = utf8Next(&p);
+                line = FONT5X7(c);
+                for (col = 0; col < GLYPH_W; col++)
+                    spanRun(sp, col < GLYPH_COLS && (line[col] & (1 << row)), scale);
+            }
+}
 
+// Tabela sFONT para drawStringScaled. mapped é constante em cada chamada
+// (font->Map é testado uma vez em drawStringScaled), então o compilador gera
+// um laço para cada caso, sem teste por glifo.
+static inline void scaledFont(Span * sp, const char *str, const sFONT *font,
+                              uint8_t scale, uint8_t mapped)
+{
+    uint16_t w = font->Width, h = font->Height;
+    uint16_t stride = (w + 7) / 8;         // Bytes por linha do glifo
+    uint16_t glyphBytes = h * stride;
+    uint16_t row, col, rowOff;
+    const char * p;
+    const uint8_t * line;
+    uint8_t bits, ch, rep;
 
+    for (row = 0, rowOff = 0; row < h; row++, rowOff += stride) {
+        for (rep = 0; rep < scale; rep++) {
+            for (p = str; *p; ) {
+                ch = utf8Next(&p) - ' ';
+                if (ch >= 95)
+                    ch = 0;
+                if (mapped)
+                    ch = font->Map[ch];     // Tabela gerada por sim/fontsubset
+                line = font->table + ch * glyphBytes + rowOff;
+                bits = 0;
+                for (col = 0; col < w; col++, bits <<= 1) {
+                    if (!(col & 7))
+                        bits = *line++;
+                    spanRun(sp, bits >> 7, scale);
+                }
+            }
+        }
+    }
+}
+
+// Texto opaco ampliado por um fator inteiro, sem tabelas extras: cada linha
+// da fonte é enviada scale vezes e cada pixel vira um trecho de scale pixels,
+// que spanRun junta aos vizinhos da mesma cor. Uma única janela cobre a
+// string, então um título em 3x custa os mesmos comandos de endereço que o
+// texto em 1x. font = 0 usa a font5x7 em células de 6x8; as tabelas sFONT
+// seguem o formato de drawStringFont. A fonte é escolhida uma vez, fora dos
+// laços de linha e de glifo.
+void drawStringScaled(uint16_t x, uint16_t y, const char *str, const sFONT *font,
+                      uint8_t scale, tft_color_t color, tft_color_t bg)
+{
+    uint8_t fg[TFT_PIXEL_BYTES], bk[TFT_PIXEL_BYTES];
+    uint16_t w = font ? font->Width : GLYPH_W;
+    uint16_t h = font ? font->Height : GLYPH_H;
+    uint16_t n = utf8Len(str);
+    Span sp = { { bk, fg }, 0, 0 };
+
+    if (!n || !scale)
+        return;
+    tftBytes(color, fg);
+    tftBytes(bg, bk);
+    tftBegin();
+    Address_set(x, y, x + n * w * scale - 1, y + h * scale - 1);
+    if (!font)
+        scaled5x7(&sp, str, scale);
+    else if (font->Map)
+        scaledFont(&sp, str, font, scale, 1);
+    else
+        scaledFont(&sp, str, font, scale, 0);
+    spanEnd(&sp);
+    tftEnd();
+}
+
+// Índice do glifo de c numa fonte proporcional (fora da faixa: o primeiro)
+static uint8_t propGlyph(const PropFont * font, uint8_t c)
+{
+    uint8_t k = c - font->first;
+
+    return k < font->count ? k : 0;
+}
+
+// Colunas de fundo entre o glifo k e o caractere next: o espaçamento da fonte
+// mais o kerning do par, se houver
+static uint8_t propGap(const PropFont * font, uint8_t k, uint8_t next)
+{
+    const KernPair * kp  = font->kern + font->kernIdx[k];
+    const KernPair * end = font->kern + font->kernIdx[k + 1];
+
+    for (; kp < end; kp++)
+        if ((uint8_t)kp->right == next)
+            return font->spacing + kp->dx;
+    return font->spacing;
+}
+
+// Largura em pixels de str numa fonte proporcional: glifos e espaçamentos
+// entre eles, sem o espaçamento depois do último
+uint16_t measureString(const char *str, const PropFont *font)
+{
+    uint16_t w = 0;
+    uint8_t k, c;
+
+    if (!*str)
+        return 0;
+    c = utf8Next(&str);
+    for (;;) {
+        k = propGlyph(font, c);
+        w += font->offset[k + 1] - font->offset[k];
+        if (!*str)
+            return w;
+        c = utf8Next(&str);
+        w += propGap(font, k, c);
+    }
+}
+
+// Texto opaco numa fonte proporcional, com 8 linhas de altura: uma única
+// janela de measureString(str) x 8, enviada por colunas com MV desligado como
+// em glyphCells. Só as colunas de cada glifo e os espaçamentos (já com o
+// kerning) passam pelo barramento.
+void drawStringProp(uint16_t x, uint16_t y, const char *str, const PropFont *font,
+                    tft_color_t color, tft_color_t bg)
+{
+    uint8_t fg[TFT_PIXEL_BYTES], bk[TFT_PIXEL_BYTES];
+    uint16_t w = measureString(str, font), c;
+    uint8_t k, row, line, next;
+    Span sp = { { bk, fg }, 0, 0 };
+
+    if (!w)
+        return;
+    tftBytes(color, fg);
+    tftBytes(bg, bk);
+    tftBegin();
+    tftMadctl(MADCTL_COLS);
+    Address_set(y, x, y + GLYPH_H - 1, x + w - 1);
+    for (next = utf8Next(&str); ; ) {
+        k = propGlyph(font, next);
+        for (c = font->offset[k]; c < font->offset[k + 1]; c++) {
+            line = font->cols[c];
+            for (row = 0; row < GLYPH_H; row++, line >>= 1)
+                spanRun(&sp, line & 1, 1);
+        }
+        if (!*str)
+            break;
+        next = utf8Next(&str);
+        spanRun(&sp, 0, GLYPH_H * propGap(font, k, next));
+    }
+    spanEnd(&sp);
+    tftMadctl(TFT_MADCTL);
+    tftEnd();
+}
+
+// Cor a lvl/3 do caminho de bg até color, canal a canal, já no formato do
+// barramento. Os produtos ficam aqui, quatro vezes por string.
+static tft_color_t tftBlend(tft_color_t color, tft_color_t bg, uint8_t lvl)
+{
+#if TFT_RGB565
+    static const uint32_t mask[3] = { 0xF800, 0x07E0, 0x001F };
+#else
+    static const uint32_t mask[3] = { 0xFF0000, 0x00FF00, 0x0000FF };
+#endif
+    tft_color_t out = 0;
+    int32_t f, b;
+    uint8_t i;
+
+    for (i = 0; i < 3; i++) {
+        f = color & mask[i];
+        b = bg & mask[i];
+        out |= (b + (f - b) * lvl / 3) & mask[i];
+    }
+    return out;
+}
+
+// Texto opaco numa fonte anti-aliased de 2 bits por pixel: as quatro cores
+// (fundo, 1/3, 2/3 e frente) são calculadas uma vez por string, e o laço
+// interno só desloca os bits do glifo e indexa a tabela. Uma única janela
+// cobre a string, enviada por linhas como drawStringScaled. Caracteres fora
+// de ' '..'~' viram espaço. Só são desenhados os caracteres que cabem
+// inteiros até a borda direita da tela em paisagem (x = 320); o resto da
+// string é cortado.
+void drawStringAA(uint16_t x, uint16_t y, const char *str, const AAFont *font,
+                  tft_color_t color, tft_color_t bg)
+{
+    uint8_t lut[4][TFT_PIXEL_BYTES];
+    const uint8_t * glyph[AA_CHARS];
+    uint16_t stride = (font->width + 3) / 4;
+    uint16_t glyphBytes = font->height * stride;
+    uint16_t n = 0, row, col, rowOff;
+    const char * p;
+    const uint8_t * line;
+    uint8_t bits, ch, lvl, i;
+    Span sp = { { lut[0], lut[1], lut[2], lut[3] }, 0, 0 };
+
+    // Início de cada glifo, calculado uma vez por caractere
+    for (p = str; *p && n < AA_CHARS && x + (n + 1) * font->width <= 320; n++) {
+        ch = utf8Next(&p) - ' ';
+        if (ch >= 95)
+            ch = 0;
+        if (font->map)
+            ch = font->map[ch];
+        glyph[n] = font->table + ch * glyphBytes;
+    }
+    if (!n)
+        return;
+    for (lvl = 0; lvl < 4; lvl++)
+        tftBytes(tftBlend(color, bg, lvl), lut[lvl]);
+    tftBegin();
+    Address_set(x, y, x + n * font->width - 1, y + font->height - 1);
+    for (row = 0, rowOff = 0; row < font->height; row++, rowOff += stride) {
+        for (i = 0; i < n; i++) {
+            line = glyph[i] + rowOff;
+            bits = 0;
+            for (col = 0; col < font->width; col++, bits <<= 2) {
+                if (!(col & 3))
+                    bits = *line++;
+                spanRun(&sp, bits >> 6, 1);
+            }
+        }
+    }
+    spanEnd(&sp);
+    tftEnd();
+}
+
+void drawPixel(uint16_t x, uint16_t y, tft_color_t color)
+{
+    uint8_t px[TFT_PIXEL_BYTES];
+
+    tftBytes(color, px);
+
+    // Enable CS
+    tftBegin();
+
+    tftPlot(x, y, px);
+
+    // Disable CS
+    tftEnd();
+}
+
+void drawChar_4x(uint16_t x, uint16_t y, char c, tft_color_t color)
+{
+    uint8_t px[TFT_PIXEL_BYTES];
+    const uint8_t * end;
+    const uint8_t * rle = bigGlyph(c, &end);
+
+    tftBytes(color, px);
+    tftBegin(); // Habilita CS para toda a escrita do caractere
+    rleSpans(x, y, rle, end, px);
+    tftEnd(); // Desabilita CS após escrever o caractere
+}
+
+
+void drawString_4x(uint16_t x, uint16_t y, const char *str, tft_color_t color)
+{
+    tftBegin(); // Um único CS para toda a string
+    while (*str) {
+        drawChar_4x(x, y, utf8Next(&str), color);
+        x += FONT20X28_W + 1; // Espacamento entre caracteres (20 pixels + 1 de espaco)
+    }
+    tftEnd();
+}
+
+// Opaco, numa única janela por string: o RLE já está na ordem das colunas,
+// então com MV desligado cada trecho vira um tftFill sem decodificar bits.
+// O fundo implícito do fim do glifo e a coluna de espaçamento se juntam
+// num só trecho.
+void drawString_4xOpaque(uint16_t x, uint16_t y, const char *str, tft_color_t color, tft_color_t bg)
+{
+    uint8_t fg[TFT_PIXEL_BYTES], bk[TFT_PIXEL_BYTES];
+    uint16_t n = utf8Len(str), left;
+    uint8_t on;
+    const uint8_t * rle;
+    const uint8_t * end;
+    Span sp = { { bk, fg }, 0, 0 };
+
+    if (!n)
+        return;
+    tftBytes(color, fg);
+    tftBytes(bg, bk);
+    tftBegin();
+    tftMadctl(MADCTL_COLS);
+    Address_set(y, x, y + FONT20X28_H - 1, x + n * (FONT20X28_W + 1) - 1);
+    while (*str) {
+        left = (FONT20X28_W + 1) * FONT20X28_H;
+        for (rle = bigGlyph(utf8Next(&str), &end), on = 0; rle < end; rle++, on ^= 1) {
+            spanRun(&sp, on, *rle);
+            left -= *rle;
+        }
+        spanRun(&sp, 0, left);
+    }
+    spanEnd(&sp);
+    tftMadctl(TFT_MADCTL);
+    tftEnd();
+}
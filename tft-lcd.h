@@ -4,9 +4,72 @@
 
 #include <msp430.h> 
 #include <stdint.h>
+#include "fonts.h"
+#include "_fonts/fonts.h"
 
 #define DUMMY   0xFF  // Valor padrão para transferências SPI fictícias
 
+// 1: escritas enfileiradas e enviadas pelo ISR de TX da USCI_B0 (CPU livre/LPM0)
+// 0: escritas diretas no SPI, aguardando cada bloco
+#ifndef TFT_SPI_QUEUE
+#define TFT_SPI_QUEUE 1
+#endif
+
+// Formato de pixel no barramento: 1 = RGB565 (COLMOD 0x55, 2 bytes/pixel)
+//                                 0 = RGB666 (COLMOD 0x66, 3 bytes/pixel)
+#ifndef TFT_RGB565
+#define TFT_RGB565 1
+#endif
+
+#if TFT_RGB565
+#define TFT_PIXEL_BYTES 2
+#define TFT_COLMOD      0x55
+#else
+#define TFT_PIXEL_BYTES 3
+#define TFT_COLMOD      0x66
+#endif
+
+// Cor já codificada no formato do barramento (byte mais significativo sai
+// primeiro). Cabe em um registrador no RGB565 e em dois no RGB666, e os laços
+// de desenho só copiam os bytes prontos.
+#if TFT_RGB565
+typedef uint16_t tft_color_t;
+#define TFT_RGB(r, g, b)  ((tft_color_t)((((r) & 0xF8u) << 8) | (((g) & 0xFCu) << 3) | (((b) & 0xFFu) >> 3)))
+#else
+typedef uint32_t tft_color_t;
+#define TFT_RGB(r, g, b)  ((tft_color_t)(((uint32_t)((r) & 0xFFu) << 16) | (((g) & 0xFFu) << 8) | ((b) & 0xFFu)))
+#endif
+
+#define TFT_HEX(rgb)      TFT_RGB(((rgb) >> 16) & 0xFF, ((rgb) >> 8) & 0xFF, (rgb) & 0xFF)    // 0xRRGGBB
+#define TFT_WIRE(v)       ((tft_color_t)(v))     // Valor já no formato do barramento (ex.: 0xF800)
+
+#define TFT_BLACK   TFT_HEX(0x000000)
+#define TFT_WHITE   TFT_HEX(0xFFFFFF)
+#define TFT_RED     TFT_HEX(0xFF0000)
+#define TFT_GREEN   TFT_HEX(0x00FF00)
+#define TFT_BLUE    TFT_HEX(0x0000FF)
+
+// Texto opaco (drawCharOpaque/drawStringOpaque/drawStringLine):
+//   1 = MADCTL com MV desligado durante o texto, colunas da font5x7 enviadas direto
+//   0 = varredura por linhas na orientação normal
+#ifndef TFT_TEXT_COLUMNS
+#define TFT_TEXT_COLUMNS 1
+#endif
+
+// Cache de glifos da font5x7 já codificados no formato do barramento (célula
+// de 6x8 para um par cor/fundo), usado pelo texto opaco. Número de entradas;
+// 0 desliga. As entradas ficam na USBRAM (0x1C00, 2 KB), livre enquanto o
+// módulo USB não é usado.
+#ifndef TFT_GLYPH_CACHE
+#if TFT_RGB565
+#define TFT_GLYPH_CACHE 16    // 16 x 96 bytes
+#else
+#define TFT_GLYPH_CACHE 12    // 12 x 144 bytes
+#endif
+#endif
+
+#define TFT_MADCTL 0x28    // Orientação de tftInitSeq: paisagem (MV) e ordem BGR
+
 // Definições de pinos de controle do LCD
 #define CSDIR   P8DIR
 #define CSOUT   P8OUT
@@ -24,9 +87,33 @@
 #define DCOUT   P2OUT
 #define DCBIT   BIT6
 
+// Contadores da sessão, zerados a cada tftTakeStats()
+typedef struct {
+    uint16_t gpioWrites;    // Escritas efetivas em CSOUT/DCOUT
+    uint16_t gpioSaved;     // Escritas evitadas (nível já correto ou sessão aninhada)
+    uint16_t addrSaved;     // Bytes de CASET/PASET evitados pelo cache de janela
+    uint16_t glyphHits;     // Células de texto enviadas direto do cache de glifos
+    uint16_t glyphMisses;   // Células codificadas e gravadas no cache
+} TftStats;
 
-void tftConfig ();
-void tftInitSeq();
+
+// Inicialização sem espera ativa: tftConfig() configura os pinos e começa a
+// sequência do display, que prossegue a cada tftInitPoll() (1 = pronto)
+// enquanto main() faz o resto da configuração. O primeiro tftBegin() completa
+// o que faltar. tftInitSeq() reinicia o display e só retorna com ele pronto.
+// Requer timeConfig(). Cada espera conta o tempo decorrido desde que foi
+// armada, então pode ficar até 2 s sem tftInitPoll() sem atrasar a sequência.
+void    tftConfig   ();
+void    tftInitStart();
+uint8_t tftInitPoll ();
+void    tftInitSeq  ();
+void    tftFlush    ();
+
+// Sessão: CS fica ativo de tftBegin() até o tftEnd() correspondente; as
+// primitivas de desenho podem ser agrupadas dentro de um único par
+void tftBegin    ();
+void tftEnd      ();
+void tftTakeStats(TftStats * st);
 
 void sWcmd      (uint8_t byte);
 void sWdata     (uint8_t byte);
@@ -34,18 +121,37 @@ void tftWrite   (uint8_t cmd, uint8_t * data, uint8_t nData);
 void tftRead    (uint8_t cmd, uint8_t * data, uint8_t nData);
 
 void Address_set(uint16_t x1,uint16_t y1,uint16_t x2,uint16_t y2);
-void draw_pixel (uint16_t cr,uint16_t cg,uint16_t cb);
-void LCD_Clear  (uint16_t cr, uint16_t cv, uint16_t cb, int screen_orientation);
+void draw_pixel (tft_color_t color);
+void LCD_Clear  (tft_color_t color, int screen_orientation);
 
 void LCD_Arc   ();
 void LCD_Carre ();
 
-void drawPixel  (uint16_t x, uint16_t y, uint16_t cr, uint16_t cg, uint16_t cb);
-void drawChar   (uint16_t x, uint16_t y, char c, uint16_t cr, uint16_t cg, uint16_t cb);
-void drawString (uint16_t x, uint16_t y, const char *str, uint16_t cr, uint16_t cg, uint16_t cb);
+void drawPixel  (uint16_t x, uint16_t y, tft_color_t color);
+void drawChar   (uint16_t x, uint16_t y, char c, tft_color_t color);
+void drawString (uint16_t x, uint16_t y, const char *str, tft_color_t color);
+
+// Texto opaco: cada célula de 6x8 é enviada inteira com a cor de fundo bg
+void drawCharOpaque   (uint16_t x, uint16_t y, char c, tft_color_t color, tft_color_t bg);
+void drawStringOpaque (uint16_t x, uint16_t y, const char *str, tft_color_t color, tft_color_t bg);
+void drawStringLine   (uint16_t x, uint16_t y, const char *str, tft_color_t color, tft_color_t bg);
+void drawStringFont   (uint16_t x, uint16_t y, const char *str, const sFONT *font,
+                       tft_color_t color, tft_color_t bg);
+void drawStringScaled (uint16_t x, uint16_t y, const char *str, const sFONT *font,
+                       uint8_t scale, tft_color_t color, tft_color_t bg);   // font = 0: font5x7
+void drawStringProp   (uint16_t x, uint16_t y, const char *str, const PropFont *font,
+                       tft_color_t color, tft_color_t bg);
+uint16_t measureString(const char *str, const PropFont *font);
+void drawStringAA     (uint16_t x, uint16_t y, const char *str, const AAFont *font,
+                       tft_color_t color, tft_color_t bg);
 
-void drawChar_4x    (uint16_t x, uint16_t y, char c, uint16_t cr, uint16_t cg, uint16_t cb);
-void drawString_4x  (uint16_t x, uint16_t y, const char *str, uint16_t cr, uint16_t cg, uint16_t cb);
+void drawChar_4x    (uint16_t x, uint16_t y, char c, tft_color_t color);
+void drawString_4x  (uint16_t x, uint16_t y, const char *str, tft_color_t color);
+void drawString_4xOpaque(uint16_t x, uint16_t y, const char *str, tft_color_t color, tft_color_t bg);
 void drawRect       (uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+void fillRect       (uint16_t x, uint16_t y, uint16_t w, uint16_t h, tft_color_t color);
+void drawHLine      (uint16_t x, uint16_t y, uint16_t w, tft_color_t color);
+void drawVLine      (uint16_t x, uint16_t y, uint16_t h, tft_color_t color);
+void drawFrame      (uint16_t x, uint16_t y, uint16_t w, uint16_t h, tft_color_t color);
 
 #endif  // __TFT_LCD_H
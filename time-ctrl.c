@@ -3,8 +3,68 @@
 #include <stdint.h>
 #include "time-ctrl.h"
 
+#define DELAY_STEP 500     // ms por prazo em delay(): bem dentro da janela de 1 s
+
 void delay(unsigned int i)
 {
-    while(i--)  // Decrementa até zero
-        __delay_cycles(FPROC/1000);  // Gera um atraso baseado na frequência do processador
+    uint16_t t = timeNow();
+    unsigned int n;
+
+    while (i) {
+        n = i < DELAY_STEP ? i : DELAY_STEP;
+        t += TIME_MS(n);   // Prazos encadeados: o atraso total não acumula erro
+        delayUntil(t);
+        i -= n;
+    }
+    __enable_interrupt();  // Também em delay(0), que não passa por delayUntil
+}
+
+// Dorme em LPM3 até a comparação do CCR0 com o prazo. A USCI e o DMA seguem
+// transmitindo: pedem SMCLK/MCLK por requisição condicional e seus ISRs só
+// acordam a CPU para ela voltar a dormir.
+void delayUntil(uint16_t deadline)
+{
+    __disable_interrupt();
+    TA0CCR0  = deadline;
+    TA0CCTL0 = CCIE;       // Limpa CCIFG e arma a comparação
+    while (!timeReached(deadline)) {
+        __bis_SR_register(LPM3_bits | GIE);
+        __disable_interrupt();
+    }
+    TA0CCTL0 = 0;
+    __bic_SR_register(SCG1 | SCG0);   // Um ISR que só limpou CPUOFF deixa SMCLK e o FLL parados
+    __enable_interrupt();
+}
+
+void timeConfig()
+{
+    UCSCTL4 = (UCSCTL4 & ~SELA_7) | SELA_2;  // ACLK = REFO (32.768 Hz), independente do FLL
+    UCSCTL5 &= ~DIVA_7;                      // ACLK sem divisão
+    TA0CTL  = TASSEL_1 | MC_2 | TACLR;       // Timer_A0 em ACLK, modo contínuo
+}
+
+uint16_t timeNow()
+{
+    uint16_t t;
+
+    do
+        t = TA0R;
+    while (t != TA0R);     // ACLK é assíncrono a MCLK: repete até duas leituras iguais
+    return t;
+}
+
+uint8_t timeReached(uint16_t deadline)
+{
+    return (int16_t)(timeNow() - deadline) >= 0;
+}
+
+uint8_t timeElapsed(uint16_t since, uint16_t ticks)
+{
+    return (uint16_t)(timeNow() - since) >= ticks;
+}
+
+#pragma vector=TIMER0_A0_VECTOR
+__interrupt void TIMER0_A0_ISR(void)
+{
+    __bic_SR_register_on_exit(LPM3_bits);    // O vetor do CCR0 já limpa CCIFG
 }
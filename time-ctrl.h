@@ -7,7 +7,29 @@
 
 #define FPROC 25000000 // Frequência do processador em Hz
 
-// Função para gerar um atraso (delay) em milissegundos
-void delay(unsigned int i);
+#define TIME_HZ 32768  // Ticks de timeNow() por segundo (Timer_A0 em ACLK = REFO)
+
+// Converte ms em ticks de timeNow(), arredondando para cima
+#define TIME_MS(ms) ((uint16_t)(((uint32_t)(ms) * TIME_HZ + 999) / 1000))
+
+// Base de tempo para prazos: o Timer_A0 conta ACLK continuamente, sem
+// depender do DCO, então continua certo enquanto main() reconfigura o clock.
+// Um prazo é timeNow() + TIME_MS(ms) e vale até 1 s à frente. O contador dá
+// a volta a cada 2 s, então um prazo consultado mais de 1 s depois de vencido
+// volta a parecer futuro (e delayUntil dormiria até a volta seguinte). Quem
+// pode consultar tarde, com trabalho longo entre as consultas, guarda o
+// início da espera e usa timeElapsed(), que vale até 2 s depois do início.
+void     timeConfig   ();
+uint16_t timeNow      ();
+uint8_t  timeReached  (uint16_t deadline);
+uint8_t  timeElapsed  (uint16_t since, uint16_t ticks);   // timeNow() - since >= ticks
+
+// Atrasos em LPM3: a CPU dorme até a comparação do CCR0 do Timer_A0 e só o
+// ACLK fica ligado. delay() espera i milissegundos, como antes; delayUntil()
+// espera até um prazo. Ambas requerem timeConfig() antes: sem o Timer_A0
+// contando, nada acorda a CPU. Ambas habilitam as interrupções (GIE) ao
+// retornar, inclusive delay(0).
+void delay     (unsigned int i);
+void delayUntil(uint16_t deadline);
 
 #endif // __TIME_CTRL_H